@@ -0,0 +1,138 @@
+/**
+ * @file LinearSolversBenchmark.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "algorithms/src/LinearSolvers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+namespace
+{
+
+using namespace SPHAlgorithms;
+
+struct Node
+{
+    SizetVector neighbours;
+};
+
+/**
+ * @brief Returns the matrix of the cubic lattice of n^3 nodes, the neighbours are within two lattice spacings
+ * (32 neighbours inside), as the particles at the rest spacing have. The coefficients are of the viscosity,
+ * the matrix is symmetric and diagonally dominant.
+ */
+NeighbourMatrix createLatticeMatrix(int n, double stiffness)
+{
+    std::vector<Node> nodes(static_cast<size_t>(n * n * n));
+
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            for (int k = 0; k < n; k++)
+                for (int di = -2; di <= 2; di++)
+                    for (int dj = -2; dj <= 2; dj++)
+                        for (int dk = -2; dk <= 2; dk++)
+                        {
+                            const int distanceSqr = di * di + dj * dj + dk * dk;
+                            if (distanceSqr == 0 || distanceSqr > 4 || i + di < 0 || i + di >= n || j + dj < 0 ||
+                                j + dj >= n || k + dk < 0 || k + dk >= n)
+                                continue;
+
+                            nodes[(i * n + j) * n + k].neighbours.push_back(
+                                static_cast<size_t>(((i + di) * n + j + dj) * n + k + dk));
+                        }
+
+    NeighbourMatrix matrix;
+    matrix.setPattern(nodes);
+
+    for (int i = 0; i < n * n * n; i++)
+    {
+        double diagonal = 1.;
+
+        for (size_t pair = matrix.getPairsBegin(i); pair < matrix.getPairsEnd(i); pair++)
+        {
+            const size_t column = matrix.getColumn(pair);
+            const int di = static_cast<int>(column) / (n * n) - i / (n * n);
+            const int dj = static_cast<int>(column) / n % n - i / n % n;
+            const int dk = static_cast<int>(column) % n - i % n;
+
+            const double coefficient = stiffness * (1. - std::sqrt(di * di + dj * dj + dk * dk) / 2.5);
+
+            matrix.setCoefficient(pair, -coefficient);
+            diagonal += coefficient;
+        }
+
+        matrix.setDiagonal(i, diagonal);
+    }
+
+    return matrix;
+}
+
+std::vector<Point3D> createRightHandSide(size_t size)
+{
+    std::vector<Point3D> rhs(size);
+    for (size_t i = 0; i < size; i++)
+        rhs[i] = Point3D(std::sin(0.1 * i), std::cos(0.3 * i), 1.);
+
+    return rhs;
+}
+
+void BM_Multiply(benchmark::State& state)
+{
+    const NeighbourMatrix matrix = createLatticeMatrix(static_cast<int>(state.range(0)), 1.);
+    const std::vector<Point3D> x = createRightHandSide(matrix.getRowsNumber());
+    std::vector<Point3D> result;
+
+    for (auto _ : state)
+    {
+        multiply(matrix, x, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * matrix.getPairsEnd(x.size() - 1u)));
+}
+
+void BM_DotProduct(benchmark::State& state)
+{
+    const std::vector<double> x(static_cast<size_t>(state.range(0)), 0.5);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(calcDotProduct(x, x));
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * x.size()));
+}
+
+// The stiffness 10 is of the viscosity of the honey-like fluid at the time step of 10 ms
+template <class Solver> void BM_Solve(benchmark::State& state)
+{
+    const NeighbourMatrix matrix = createLatticeMatrix(static_cast<int>(state.range(0)), 10.);
+    const std::vector<Point3D> rhs = createRightHandSide(matrix.getRowsNumber());
+    std::vector<Point3D> x;
+
+    Solver solver(1e-5, 1000u);
+
+    for (auto _ : state)
+    {
+        x.assign(rhs.size(), Point3D());
+        solver.solve(matrix, rhs, x);
+        benchmark::DoNotOptimize(x.data());
+    }
+
+    state.counters["iterations"] = static_cast<double>(solver.getStatistics().iterationsNumber);
+    state.counters["residual"] = solver.getStatistics().residual;
+}
+
+} // namespace
+
+BENCHMARK(BM_Multiply)->Arg(16)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DotProduct)->Arg(1 << 12)->Arg(1 << 18);
+BENCHMARK_TEMPLATE(BM_Solve, JacobiSolver<Point3D>)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Solve, GaussSeidelSolver<Point3D>)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Solve, ConjugateGradientSolver<Point3D>)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Solve, BiConjugateGradientStabilizedSolver<Point3D>)
+    ->Arg(16)
+    ->Arg(32)
+    ->Unit(benchmark::kMillisecond);
@@ -6,6 +6,10 @@
 
 #include "Area.h"
 
+#include "DistanceField.h"
+
+#include <algorithm>
+
 namespace SPHAlgorithms
 {
 
@@ -34,15 +38,83 @@ bool Area::isInsideArea(const Point2D& /*point*/)
     return false;
 }
 
+Cuboid intersectCuboids(const Cuboid& first, const Cuboid& second)
+{
+    const Point3D start(std::max(first.startingPoint.x, second.startingPoint.x),
+                        std::max(first.startingPoint.y, second.startingPoint.y),
+                        std::max(first.startingPoint.z, second.startingPoint.z));
+    const Point3D end(std::min(first.startingPoint.x + first.width, second.startingPoint.x + second.width),
+                      std::min(first.startingPoint.y + first.length, second.startingPoint.y + second.length),
+                      std::min(first.startingPoint.z + first.height, second.startingPoint.z + second.height));
+
+    return Cuboid(start, std::max(0., end.x - start.x), std::max(0., end.y - start.y), std::max(0., end.z - start.z));
+}
+
+Cuboid uniteCuboids(const Cuboid& first, const Cuboid& second)
+{
+    const Point3D start(std::min(first.startingPoint.x, second.startingPoint.x),
+                        std::min(first.startingPoint.y, second.startingPoint.y),
+                        std::min(first.startingPoint.z, second.startingPoint.z));
+    const Point3D end(std::max(first.startingPoint.x + first.width, second.startingPoint.x + second.width),
+                      std::max(first.startingPoint.y + first.length, second.startingPoint.y + second.length),
+                      std::max(first.startingPoint.z + first.height, second.startingPoint.z + second.height));
+
+    return Cuboid(start, end.x - start.x, end.y - start.y, end.z - start.z);
+}
+
+Cuboid expandCuboid(const Cuboid& cuboid, double margin)
+{
+    return Cuboid(cuboid.startingPoint - Point3D(margin, margin, margin),
+                  cuboid.width + 2. * margin,
+                  cuboid.length + 2. * margin,
+                  cuboid.height + 2. * margin);
+}
+
 Volume::Volume() :
     m_boundingCuboid(Cuboid()) {}
 
 Volume::Volume(const Cuboid& cube) :
     m_boundingCuboid(cube) {}
 
+Volume::Volume(const Cuboid& cube, const std::function<float(float, float, float)>& domain, double cellSize) :
+    m_boundingCuboid(cube),
+    m_domainField(std::make_shared<const DistanceField>(domain, cube, cellSize)) {}
+
 Cuboid Volume::getBoundingCuboid() const
 {
     return m_boundingCuboid;
 }
 
+bool Volume::hasDomain() const
+{
+    return m_domainField != nullptr;
+}
+
+float Volume::getDomainDistance(const Point3D& point) const
+{
+    return m_domainField->value(Point3F(static_cast<float>(point.x),
+                                        static_cast<float>(point.y),
+                                        static_cast<float>(point.z)));
+}
+
+Point3D Volume::getDomainNormal(const Point3D& point) const
+{
+    const Point3F gradient = m_domainField->gradient(Point3F(static_cast<float>(point.x),
+                                                             static_cast<float>(point.y),
+                                                             static_cast<float>(point.z)));
+
+    return Point3D(gradient.x, gradient.y, gradient.z);
+}
+
+bool Volume::intersectsDomain(const Cuboid& cuboid) const
+{
+    if (!hasDomain())
+        return true;
+
+    // the cuboid is inside of the sphere around its center
+    const Point3D halfSize(cuboid.width / 2., cuboid.length / 2., cuboid.height / 2.);
+
+    return getDomainDistance(cuboid.startingPoint + halfSize) + halfSize.calcNorm() > 0.;
+}
+
 } //SPHAlgorithms
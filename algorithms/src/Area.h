@@ -9,9 +9,14 @@
 
 #include "Point.h"
 
+#include <functional>
+#include <memory>
+
 namespace SPHAlgorithms
 {
 
+class DistanceField;
+
 // TODO move to common and to separate class
 struct Rect
 {
@@ -49,6 +54,21 @@ struct Cuboid
         height(_height) {}
 };
 
+/**
+* @brief Returns the common part of two cuboids, the sizes are zero if they don't intersect.
+*/
+Cuboid intersectCuboids(const Cuboid& first, const Cuboid& second);
+
+/**
+* @brief Returns the smallest cuboid which contains both cuboids.
+*/
+Cuboid uniteCuboids(const Cuboid& first, const Cuboid& second);
+
+/**
+* @brief Returns the cuboid enlarged by the margin in every direction.
+*/
+Cuboid expandCuboid(const Cuboid& cuboid, double margin);
+
 /**
 * @brief Area class defines area.
 */
@@ -78,6 +98,8 @@ private:
 * The x-axis is equal to width.
 * The y-axis is equal to length.
 * The z-axis is equal to height.
+* The volume can be bounded by the domain equation (> 0 inside) in addition to its cuboid,
+* e.g. a cylindrical tank. The equation is sampled once into the distance field.
 */
 class Volume
 {
@@ -87,14 +109,41 @@ public:
 
     explicit Volume(const Cuboid& cube);
 
+    /**
+    * @param cube        The cuboid which contains the domain
+    * @param domain      The domain equation, > 0 inside the domain
+    * @param cellSize    The cell size of the distance field
+    */
+    Volume(const Cuboid& cube, const std::function<float(float, float, float)>& domain, double cellSize);
+
     ~Volume() = default;
 
     Cuboid getBoundingCuboid() const;
 
+    bool hasDomain() const;
+
+    /**
+    * @brief Returns the approximate signed distance to the domain border, > 0 inside.
+    */
+    float getDomainDistance(const Point3D& point) const;
+
+    /**
+    * @brief Returns the unit normal of the domain border, it points into the domain.
+    */
+    Point3D getDomainNormal(const Point3D& point) const;
+
+    /**
+    * @brief Returns false if the cuboid is entirely outside of the domain, the volume without the domain
+    * intersects every cuboid.
+    */
+    bool intersectsDomain(const Cuboid& cuboid) const;
+
 private:
 
     Cuboid m_boundingCuboid;
 
+    std::shared_ptr<const DistanceField> m_domainField; // shared by the copies of the volume
+
 };
 
 } //SPHAlgorithms
@@ -0,0 +1,153 @@
+/**
+ * @file DistanceField.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "DistanceField.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace SPHAlgorithms
+{
+
+DistanceField::DistanceField(const std::function<float(float, float, float)>& f,
+                             const Cuboid&                                     cuboid,
+                             double                                            cellSize)
+    : m_cuboid(cuboid)
+    , m_cellSize(static_cast<float>(cellSize))
+{
+    const double extent[3] = {m_cuboid.width, m_cuboid.length, m_cuboid.height};
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        m_nodesNumber[axis] = std::max<size_t>(2u, static_cast<size_t>(std::ceil(extent[axis] / cellSize)) + 1u);
+    }
+
+    const size_t nodesNumber = m_nodesNumber[0] * m_nodesNumber[1] * m_nodesNumber[2];
+    m_values.resize(nodesNumber);
+    m_gradients.resize(nodesNumber);
+
+    // central differences step
+    const float h = m_cellSize / 2.f;
+
+    for (size_t iZ = 0u; iZ < m_nodesNumber[2]; ++iZ)
+    {
+        for (size_t iY = 0u; iY < m_nodesNumber[1]; ++iY)
+        {
+            for (size_t iX = 0u; iX < m_nodesNumber[0]; ++iX)
+            {
+                const float x = static_cast<float>(m_cuboid.startingPoint.x) + iX * m_cellSize;
+                const float y = static_cast<float>(m_cuboid.startingPoint.y) + iY * m_cellSize;
+                const float z = static_cast<float>(m_cuboid.startingPoint.z) + iZ * m_cellSize;
+
+                const Point3F gradient((f(x + h, y, z) - f(x - h, y, z)) / (2.f * h),
+                                       (f(x, y + h, z) - f(x, y - h, z)) / (2.f * h),
+                                       (f(x, y, z + h) - f(x, y, z - h)) / (2.f * h));
+                const float gradientNorm = gradient.calcNorm();
+
+                const size_t index = nodeIndex(iX, iY, iZ);
+
+                if (gradientNorm > FLT_EPSILON)
+                {
+                    m_values[index] = f(x, y, z) / gradientNorm;
+                    m_gradients[index] = gradient / gradientNorm;
+                }
+                else
+                {
+                    m_values[index] = f(x, y, z);
+                }
+            }
+        }
+    }
+}
+
+float DistanceField::value(const Point3F& point) const
+{
+    size_t index[3];
+    float  weight[3];
+    locate(point, index, weight);
+
+    float result = 0.f;
+
+    for (size_t corner = 0u; corner < 8u; ++corner)
+    {
+        const size_t dX = corner & 1u;
+        const size_t dY = (corner >> 1) & 1u;
+        const size_t dZ = (corner >> 2) & 1u;
+
+        const float cornerWeight = (dX ? weight[0] : 1.f - weight[0]) * (dY ? weight[1] : 1.f - weight[1]) *
+                                   (dZ ? weight[2] : 1.f - weight[2]);
+
+        result += cornerWeight * m_values[nodeIndex(index[0] + dX, index[1] + dY, index[2] + dZ)];
+    }
+
+    // the point outside the grid is moved away from the border by its distance to the grid
+    const Point3F start(static_cast<float>(m_cuboid.startingPoint.x), static_cast<float>(m_cuboid.startingPoint.y),
+                        static_cast<float>(m_cuboid.startingPoint.z));
+    const Point3F end = start + Point3F(static_cast<float>(m_cuboid.width), static_cast<float>(m_cuboid.length),
+                                        static_cast<float>(m_cuboid.height));
+    const Point3F outside(std::max(0.f, std::max(start.x - point.x, point.x - end.x)),
+                          std::max(0.f, std::max(start.y - point.y, point.y - end.y)),
+                          std::max(0.f, std::max(start.z - point.z, point.z - end.z)));
+
+    return result - outside.calcNorm();
+}
+
+Point3F DistanceField::gradient(const Point3F& point) const
+{
+    size_t index[3];
+    float  weight[3];
+    locate(point, index, weight);
+
+    Point3F result;
+
+    for (size_t corner = 0u; corner < 8u; ++corner)
+    {
+        const size_t dX = corner & 1u;
+        const size_t dY = (corner >> 1) & 1u;
+        const size_t dZ = (corner >> 2) & 1u;
+
+        const float cornerWeight = (dX ? weight[0] : 1.f - weight[0]) * (dY ? weight[1] : 1.f - weight[1]) *
+                                   (dZ ? weight[2] : 1.f - weight[2]);
+
+        result += m_gradients[nodeIndex(index[0] + dX, index[1] + dY, index[2] + dZ)] * cornerWeight;
+    }
+
+    const float norm = result.calcNorm();
+
+    return norm > FLT_EPSILON ? result / norm : result;
+}
+
+Cuboid DistanceField::getBoundingCuboid() const
+{
+    return m_cuboid;
+}
+
+size_t DistanceField::nodeIndex(size_t iX, size_t iY, size_t iZ) const
+{
+    return iX + m_nodesNumber[0] * (iY + m_nodesNumber[1] * iZ);
+}
+
+/**
+ * @brief Finds the grid cell which contains the point clamped by the grid and the weights of its upper nodes.
+ */
+void DistanceField::locate(const Point3F& point, size_t index[3], float weight[3]) const
+{
+    const float coordinates[3] = {static_cast<float>(point.x - m_cuboid.startingPoint.x),
+                                  static_cast<float>(point.y - m_cuboid.startingPoint.y),
+                                  static_cast<float>(point.z - m_cuboid.startingPoint.z)};
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        const float maxCoordinate = static_cast<float>(m_nodesNumber[axis] - 1u);
+        const float t = std::min(std::max(coordinates[axis] / m_cellSize, 0.f), maxCoordinate);
+
+        index[axis] = std::min(static_cast<size_t>(t), m_nodesNumber[axis] - 2u);
+        weight[axis] = t - static_cast<float>(index[axis]);
+    }
+}
+
+} // namespace SPHAlgorithms
@@ -0,0 +1,75 @@
+/**
+ * @file DistanceField.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef DISTANCE_FIELD_H_5A0C2E7F4B3D4E1A9C6B8D2F1E0A7C35
+#define DISTANCE_FIELD_H_5A0C2E7F4B3D4E1A9C6B8D2F1E0A7C35
+
+#include "Area.h"
+#include "Point.h"
+
+#include <functional>
+#include <vector>
+
+namespace SPHAlgorithms
+{
+
+namespace TestEnvironment
+{
+class DistanceFieldTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief DistanceField class caches a domain equation on a regular grid.
+ * The function is sampled once in the grid nodes and normalized by its gradient length, so the cached values
+ * approximate the signed distance to the border (> 0 inside, = 0 on the border and < 0 outside).
+ * Values and gradients between the nodes are trilinearly interpolated.
+ */
+class DistanceField
+{
+    friend class TestEnvironment::DistanceFieldTestSuite;
+
+public:
+    /**
+     * @brief Samples the function in the nodes of the grid which covers the cuboid.
+     * @param f           The function that represents the domain equation
+     * @param cuboid      The cached region
+     * @param cellSize    The distance between the grid nodes
+     */
+    DistanceField(const std::function<float(float, float, float)>& f, const Cuboid& cuboid, double cellSize);
+
+    /**
+     * @brief Returns the approximate signed distance to the border, the region outside the grid is treated
+     * as being outside of the domain.
+     */
+    float value(const Point3F& point) const;
+
+    /**
+     * @brief Returns the unit gradient of the distance, it points into the domain.
+     */
+    Point3F gradient(const Point3F& point) const;
+
+    Cuboid getBoundingCuboid() const;
+
+private:
+    size_t nodeIndex(size_t iX, size_t iY, size_t iZ) const;
+
+    void locate(const Point3F& point, size_t index[3], float weight[3]) const;
+
+private:
+    Cuboid m_cuboid;
+
+    float m_cellSize;
+
+    size_t m_nodesNumber[3]; // the amount of nodes along x, y and z axis
+
+    std::vector<float> m_values;
+
+    Point3FVector m_gradients;
+};
+
+} // namespace SPHAlgorithms
+
+#endif // DISTANCE_FIELD_H_5A0C2E7F4B3D4E1A9C6B8D2F1E0A7C35
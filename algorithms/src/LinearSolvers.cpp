@@ -0,0 +1,34 @@
+/**
+ * @file LinearSolvers.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "LinearSolvers.h"
+
+#include <cmath>
+
+namespace SPHAlgorithms
+{
+
+IterativeSolver::IterativeSolver(double errorTolerance, size_t maxIterationsNumber)
+    : m_errorTolerance(errorTolerance)
+    , m_maxIterationsNumber(maxIterationsNumber)
+    , m_rhsNorm(0.)
+{
+}
+
+const SolverStatistics& IterativeSolver::getStatistics() const
+{
+    return m_statistics;
+}
+
+bool IterativeSolver::finish(double residualNormSqr)
+{
+    m_statistics.residual = std::sqrt(residualNormSqr) / m_rhsNorm;
+    m_statistics.converged = m_statistics.residual < m_errorTolerance;
+
+    return m_statistics.converged || m_statistics.iterationsNumber >= m_maxIterationsNumber;
+}
+
+} // namespace SPHAlgorithms
@@ -0,0 +1,233 @@
+/**
+ * @file LinearSolvers.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef LINEAR_SOLVERS_H_A964764D7D804B89B2BD57AB94338029
+#define LINEAR_SOLVERS_H_A964764D7D804B89B2BD57AB94338029
+
+#include "Defines.h"
+#include "Point.h"
+
+#include <vector>
+
+namespace SPHAlgorithms
+{
+
+/**
+ * The solvers work on the systems A x = b over the neighbour graph of the particles. The matrix is not required
+ * to be stored, it is any class with the methods
+ *     size_t getRowsNumber() const;
+ *     double getDiagonal(size_t row) const;
+ *     template <class Value> Value multiplyOffDiagonal(size_t row, const std::vector<Value>& x) const;
+ * the last one returns sum A_ij * x_j over j != i. The values are double or Point3D, the Point3D system is the three
+ * systems of the components with the same matrix solved together.
+ * The loops over the rows are parallel with OpenMP, they are serial without it.
+ */
+
+inline double calcDotProduct(double a, double b)
+{
+    return a * b;
+}
+
+/**
+ * @brief Returns sum a_i . b_i, the reduction is parallel and vectorized with OpenMP.
+ */
+template <class Value> double calcDotProduct(const std::vector<Value>& a, const std::vector<Value>& b);
+
+/**
+ * @brief Computes result = A x, it is the parallel sparse matrix-vector product over the neighbour lists.
+ */
+template <class Matrix, class Value>
+void multiply(const Matrix& matrix, const std::vector<Value>& x, std::vector<Value>& result);
+
+/**
+ * @brief NeighbourMatrix is the sparse matrix with the pattern of the neighbour lists: the row of the particle has
+ * the diagonal and the coefficient of every neighbour. The coefficients are stored row by row in the order of
+ * the neighbours (the compressed sparse rows), so the product reads them sequentially.
+ */
+class NeighbourMatrix
+{
+public:
+    /**
+     * @brief Sets the rows by the neighbour lists of the items, T has the member SizetVector neighbours.
+     * The diagonal is set to 1 and the coefficients to 0.
+     */
+    template <class T> void setPattern(const std::vector<T>& items);
+
+    size_t getRowsNumber() const;
+
+    /**
+     * @brief Returns the range [getPairsBegin(row), getPairsEnd(row)) of the coefficients of the row.
+     */
+    size_t getPairsBegin(size_t row) const;
+
+    size_t getPairsEnd(size_t row) const;
+
+    /**
+     * @brief Returns the column of the coefficient, it is the neighbour of the pair.
+     */
+    size_t getColumn(size_t pair) const;
+
+    double getDiagonal(size_t row) const;
+
+    void setDiagonal(size_t row, double value);
+
+    double getCoefficient(size_t pair) const;
+
+    void setCoefficient(size_t pair, double value);
+
+    template <class Value> Value multiplyOffDiagonal(size_t row, const std::vector<Value>& x) const;
+
+private:
+    SizetVector m_offsets; // the first pair of every row and the amount of the pairs at the end
+
+    SizetVector m_columns;
+
+    std::vector<double> m_coefficients;
+
+    std::vector<double> m_diagonal;
+};
+
+/**
+ * @brief SolverStatistics describes the last solve of an iterative solver.
+ */
+struct SolverStatistics
+{
+    size_t iterationsNumber = 0u;
+
+    double residual = 0.; // |b - A x| / |b|
+
+    bool converged = false;
+};
+
+/**
+ * @brief IterativeSolver keeps the stop criterion and the statistics of the solvers. The solvers keep their work
+ * vectors between the solves, so the solve of every step does not allocate, and start from the given x, so
+ * the solution of the previous step is the warm start.
+ */
+class IterativeSolver
+{
+public:
+    /**
+     * @param errorTolerance         The residual relative to the right-hand side to stop the iterations at
+     * @param maxIterationsNumber    The iterations are stopped there even if the residual is larger
+     */
+    IterativeSolver(double errorTolerance, size_t maxIterationsNumber);
+
+    const SolverStatistics& getStatistics() const;
+
+protected:
+    /**
+     * @brief Starts the statistics of the solve, returns false if the right-hand side is zero, x is zero then.
+     */
+    template <class Value> bool start(const std::vector<Value>& rhs, std::vector<Value>& x);
+
+    /**
+     * @brief Stores the residual |b - A x|^2, returns true if it is within the tolerance or the iterations are
+     * exhausted.
+     */
+    bool finish(double residualNormSqr);
+
+    double m_errorTolerance;
+
+    size_t m_maxIterationsNumber;
+
+    double m_rhsNorm;
+
+    SolverStatistics m_statistics;
+};
+
+/**
+ * @brief JacobiSolver is the relaxation x_i += w * r_i / A_ii of all the rows in parallel. It converges for
+ * the diagonally dominant matrices, the relaxation w < 1 damps the oscillations of the neighbours.
+ */
+template <class Value> class JacobiSolver : public IterativeSolver
+{
+public:
+    JacobiSolver(double errorTolerance, size_t maxIterationsNumber, double relaxation = 1.);
+
+    template <class Matrix> const SolverStatistics& solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                          std::vector<Value>& x);
+
+private:
+    double m_relaxation;
+
+    std::vector<Value> m_residuals;
+};
+
+/**
+ * @brief GaussSeidelSolver is the relaxation of the rows one by one with the values of the rows updated before,
+ * it needs about half the iterations of Jacobi but it is serial. The residual is measured during the sweep, every
+ * row before its update, so the solve makes one sweep at least and the residual of the result is smaller.
+ */
+template <class Value> class GaussSeidelSolver : public IterativeSolver
+{
+public:
+    GaussSeidelSolver(double errorTolerance, size_t maxIterationsNumber, double relaxation = 1.);
+
+    template <class Matrix> const SolverStatistics& solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                          std::vector<Value>& x);
+
+private:
+    double m_relaxation;
+};
+
+/**
+ * @brief ConjugateGradientSolver is the conjugate gradient with the diagonal preconditioner, the matrix must be
+ * symmetric positive definite.
+ */
+template <class Value> class ConjugateGradientSolver : public IterativeSolver
+{
+public:
+    ConjugateGradientSolver(double errorTolerance, size_t maxIterationsNumber);
+
+    template <class Matrix> const SolverStatistics& solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                          std::vector<Value>& x);
+
+private:
+    std::vector<double> m_inverseDiagonal;
+
+    std::vector<Value> m_residuals;
+
+    std::vector<Value> m_directions;
+
+    std::vector<Value> m_products;
+};
+
+/**
+ * @brief BiConjugateGradientStabilizedSolver is BiCGSTAB with the diagonal preconditioner, it solves
+ * the non-symmetric systems, e.g. of the particles of the different masses.
+ */
+template <class Value> class BiConjugateGradientStabilizedSolver : public IterativeSolver
+{
+public:
+    BiConjugateGradientStabilizedSolver(double errorTolerance, size_t maxIterationsNumber);
+
+    template <class Matrix> const SolverStatistics& solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                          std::vector<Value>& x);
+
+private:
+    std::vector<double> m_inverseDiagonal;
+
+    std::vector<Value> m_residuals;
+
+    std::vector<Value> m_shadowResiduals;
+
+    std::vector<Value> m_directions;
+
+    std::vector<Value> m_preconditionedDirections;
+
+    std::vector<Value> m_directionProducts;
+
+    std::vector<Value> m_preconditionedResiduals;
+
+    std::vector<Value> m_residualProducts;
+};
+
+} // namespace SPHAlgorithms
+
+#include "LinearSolvers.hpp"
+
+#endif // LINEAR_SOLVERS_H_A964764D7D804B89B2BD57AB94338029
@@ -0,0 +1,359 @@
+/**
+ * @file LinearSolvers.hpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "LinearSolvers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPHAlgorithms
+{
+
+template <class Value> double calcDotProduct(const std::vector<Value>& a, const std::vector<Value>& b)
+{
+    const int size = static_cast<int>(a.size());
+
+    double result = 0.;
+
+#if _OPENMP >= 201307
+#pragma omp parallel for simd reduction(+ : result)
+#else
+#pragma omp parallel for reduction(+ : result)
+#endif
+    for (int i = 0; i < size; i++)
+        result += calcDotProduct(a[i], b[i]);
+
+    return result;
+}
+
+template <class Matrix, class Value>
+void multiply(const Matrix& matrix, const std::vector<Value>& x, std::vector<Value>& result)
+{
+    const int size = static_cast<int>(matrix.getRowsNumber());
+
+    result.resize(x.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < size; i++)
+        result[i] = x[i] * matrix.getDiagonal(i) + matrix.multiplyOffDiagonal(i, x);
+}
+
+inline size_t NeighbourMatrix::getRowsNumber() const
+{
+    return m_diagonal.size();
+}
+
+inline size_t NeighbourMatrix::getPairsBegin(size_t row) const
+{
+    return m_offsets[row];
+}
+
+inline size_t NeighbourMatrix::getPairsEnd(size_t row) const
+{
+    return m_offsets[row + 1u];
+}
+
+inline size_t NeighbourMatrix::getColumn(size_t pair) const
+{
+    return m_columns[pair];
+}
+
+inline double NeighbourMatrix::getDiagonal(size_t row) const
+{
+    return m_diagonal[row];
+}
+
+inline void NeighbourMatrix::setDiagonal(size_t row, double value)
+{
+    m_diagonal[row] = value;
+}
+
+inline double NeighbourMatrix::getCoefficient(size_t pair) const
+{
+    return m_coefficients[pair];
+}
+
+inline void NeighbourMatrix::setCoefficient(size_t pair, double value)
+{
+    m_coefficients[pair] = value;
+}
+
+template <class T> void NeighbourMatrix::setPattern(const std::vector<T>& items)
+{
+    m_offsets.resize(items.size() + 1u);
+    m_offsets[0] = 0u;
+
+    for (size_t i = 0; i < items.size(); i++)
+        m_offsets[i + 1u] = m_offsets[i] + items[i].neighbours.size();
+
+    m_columns.resize(m_offsets.back());
+
+    for (size_t i = 0; i < items.size(); i++)
+        std::copy(items[i].neighbours.begin(), items[i].neighbours.end(), m_columns.begin() + m_offsets[i]);
+
+    m_coefficients.assign(m_offsets.back(), 0.);
+    m_diagonal.assign(items.size(), 1.);
+}
+
+template <class Value> Value NeighbourMatrix::multiplyOffDiagonal(size_t row, const std::vector<Value>& x) const
+{
+    Value result = Value();
+
+    for (size_t pair = m_offsets[row]; pair < m_offsets[row + 1u]; pair++)
+        result += x[m_columns[pair]] * m_coefficients[pair];
+
+    return result;
+}
+
+template <class Value> bool IterativeSolver::start(const std::vector<Value>& rhs, std::vector<Value>& x)
+{
+    m_statistics = SolverStatistics();
+
+    x.resize(rhs.size());
+
+    m_rhsNorm = std::sqrt(calcDotProduct(rhs, rhs));
+    if (m_rhsNorm > 0.)
+        return true;
+
+    x.assign(rhs.size(), Value());
+    m_statistics.converged = true;
+
+    return false;
+}
+
+template <class Value>
+JacobiSolver<Value>::JacobiSolver(double errorTolerance, size_t maxIterationsNumber, double relaxation)
+    : IterativeSolver(errorTolerance, maxIterationsNumber)
+    , m_relaxation(relaxation)
+{
+}
+
+template <class Value>
+template <class Matrix>
+const SolverStatistics& JacobiSolver<Value>::solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                   std::vector<Value>& x)
+{
+    if (!start(rhs, x))
+        return m_statistics;
+
+    const int size = static_cast<int>(rhs.size());
+
+    m_residuals.resize(rhs.size());
+
+    for (;;)
+    {
+        double residualNormSqr = 0.;
+
+#pragma omp parallel for reduction(+ : residualNormSqr)
+        for (int i = 0; i < size; i++)
+        {
+            m_residuals[i] = rhs[i] - x[i] * matrix.getDiagonal(i) - matrix.multiplyOffDiagonal(i, x);
+            residualNormSqr += calcDotProduct(m_residuals[i], m_residuals[i]);
+        }
+
+        if (finish(residualNormSqr))
+            break;
+
+        // the residuals of all the rows are computed before x changes
+#pragma omp parallel for
+        for (int i = 0; i < size; i++)
+            x[i] += m_residuals[i] * (m_relaxation / matrix.getDiagonal(i));
+
+        m_statistics.iterationsNumber++;
+    }
+
+    return m_statistics;
+}
+
+template <class Value>
+GaussSeidelSolver<Value>::GaussSeidelSolver(double errorTolerance, size_t maxIterationsNumber, double relaxation)
+    : IterativeSolver(errorTolerance, maxIterationsNumber)
+    , m_relaxation(relaxation)
+{
+}
+
+template <class Value>
+template <class Matrix>
+const SolverStatistics& GaussSeidelSolver<Value>::solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                        std::vector<Value>& x)
+{
+    if (!start(rhs, x))
+        return m_statistics;
+
+    for (;;)
+    {
+        double residualNormSqr = 0.;
+
+        for (size_t i = 0; i < rhs.size(); i++)
+        {
+            const Value residual = rhs[i] - x[i] * matrix.getDiagonal(i) - matrix.multiplyOffDiagonal(i, x);
+            residualNormSqr += calcDotProduct(residual, residual);
+
+            x[i] += residual * (m_relaxation / matrix.getDiagonal(i));
+        }
+
+        m_statistics.iterationsNumber++;
+
+        if (finish(residualNormSqr))
+            break;
+    }
+
+    return m_statistics;
+}
+
+template <class Value>
+ConjugateGradientSolver<Value>::ConjugateGradientSolver(double errorTolerance, size_t maxIterationsNumber)
+    : IterativeSolver(errorTolerance, maxIterationsNumber)
+{
+}
+
+template <class Value>
+template <class Matrix>
+const SolverStatistics& ConjugateGradientSolver<Value>::solve(const Matrix& matrix, const std::vector<Value>& rhs,
+                                                              std::vector<Value>& x)
+{
+    if (!start(rhs, x))
+        return m_statistics;
+
+    const int size = static_cast<int>(rhs.size());
+
+    m_inverseDiagonal.resize(rhs.size());
+    m_residuals.resize(rhs.size());
+    m_directions.resize(rhs.size());
+
+    multiply(matrix, x, m_products);
+
+    double residualProduct = 0.;
+
+#pragma omp parallel for reduction(+ : residualProduct)
+    for (int i = 0; i < size; i++)
+    {
+        m_inverseDiagonal[i] = 1. / matrix.getDiagonal(i);
+        m_residuals[i] = rhs[i] - m_products[i];
+        m_directions[i] = m_residuals[i] * m_inverseDiagonal[i];
+        residualProduct += calcDotProduct(m_residuals[i], m_directions[i]);
+    }
+
+    while (!finish(calcDotProduct(m_residuals, m_residuals)))
+    {
+        multiply(matrix, m_directions, m_products);
+
+        const double step = residualProduct / calcDotProduct(m_directions, m_products);
+
+        double nextResidualProduct = 0.;
+
+#pragma omp parallel for reduction(+ : nextResidualProduct)
+        for (int i = 0; i < size; i++)
+        {
+            x[i] += m_directions[i] * step;
+            m_residuals[i] += m_products[i] * -step;
+            nextResidualProduct += calcDotProduct(m_residuals[i], m_residuals[i]) * m_inverseDiagonal[i];
+        }
+
+        const double directionFactor = nextResidualProduct / residualProduct;
+        residualProduct = nextResidualProduct;
+
+#pragma omp parallel for
+        for (int i = 0; i < size; i++)
+            m_directions[i] = m_residuals[i] * m_inverseDiagonal[i] + m_directions[i] * directionFactor;
+
+        m_statistics.iterationsNumber++;
+    }
+
+    return m_statistics;
+}
+
+template <class Value>
+BiConjugateGradientStabilizedSolver<Value>::BiConjugateGradientStabilizedSolver(double errorTolerance,
+                                                                                size_t maxIterationsNumber)
+    : IterativeSolver(errorTolerance, maxIterationsNumber)
+{
+}
+
+template <class Value>
+template <class Matrix>
+const SolverStatistics& BiConjugateGradientStabilizedSolver<Value>::solve(const Matrix& matrix,
+                                                                          const std::vector<Value>& rhs,
+                                                                          std::vector<Value>& x)
+{
+    if (!start(rhs, x))
+        return m_statistics;
+
+    const int size = static_cast<int>(rhs.size());
+
+    m_inverseDiagonal.resize(rhs.size());
+    m_residuals.resize(rhs.size());
+    m_shadowResiduals.resize(rhs.size());
+    m_directions.assign(rhs.size(), Value());
+    m_preconditionedDirections.resize(rhs.size());
+    m_directionProducts.assign(rhs.size(), Value());
+    m_preconditionedResiduals.resize(rhs.size());
+
+    multiply(matrix, x, m_residualProducts);
+
+#pragma omp parallel for
+    for (int i = 0; i < size; i++)
+    {
+        m_inverseDiagonal[i] = 1. / matrix.getDiagonal(i);
+        m_residuals[i] = rhs[i] - m_residualProducts[i];
+        m_shadowResiduals[i] = m_residuals[i];
+    }
+
+    double residualProduct = 1.;
+    double step = 1.;
+    double stabilization = 1.;
+
+    while (!finish(calcDotProduct(m_residuals, m_residuals)))
+    {
+        const double nextResidualProduct = calcDotProduct(m_shadowResiduals, m_residuals);
+
+        // the breakdown, the shadow residuals are orthogonal to the residuals
+        if (nextResidualProduct == 0. || stabilization == 0.)
+            break;
+
+        const double directionFactor = nextResidualProduct / residualProduct * step / stabilization;
+        residualProduct = nextResidualProduct;
+
+#pragma omp parallel for
+        for (int i = 0; i < size; i++)
+        {
+            m_directions[i] =
+                m_residuals[i] + (m_directions[i] + m_directionProducts[i] * -stabilization) * directionFactor;
+            m_preconditionedDirections[i] = m_directions[i] * m_inverseDiagonal[i];
+        }
+
+        multiply(matrix, m_preconditionedDirections, m_directionProducts);
+
+        step = residualProduct / calcDotProduct(m_shadowResiduals, m_directionProducts);
+
+        // the residuals become the intermediate residuals s
+#pragma omp parallel for
+        for (int i = 0; i < size; i++)
+        {
+            x[i] += m_preconditionedDirections[i] * step;
+            m_residuals[i] += m_directionProducts[i] * -step;
+            m_preconditionedResiduals[i] = m_residuals[i] * m_inverseDiagonal[i];
+        }
+
+        m_statistics.iterationsNumber++;
+
+        multiply(matrix, m_preconditionedResiduals, m_residualProducts);
+
+        const double productNormSqr = calcDotProduct(m_residualProducts, m_residualProducts);
+        stabilization = productNormSqr > 0. ? calcDotProduct(m_residualProducts, m_residuals) / productNormSqr : 0.;
+
+#pragma omp parallel for
+        for (int i = 0; i < size; i++)
+        {
+            x[i] += m_preconditionedResiduals[i] * stabilization;
+            m_residuals[i] += m_residualProducts[i] * -stabilization;
+        }
+    }
+
+    return m_statistics;
+}
+
+} // namespace SPHAlgorithms
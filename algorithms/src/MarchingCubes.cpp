@@ -7,26 +7,15 @@
 #include "MarchingCubes.h"
 #include "MarchingCubesConfig.h"
 
+#include <algorithm>
+
 namespace SPHAlgorithms
 {
 
-Point3FVector MarchingCubes::generateMesh(std::function<float(float, float, float)> f)
+// Returns the next lattice index, the last lattice index is always the end of the block
+int MarchingCubes::nextSample(int index, int step, int end)
 {
-    Point3FVector mesh;
-
-    for (float x = X_MIN; x < X_MAX; x += GRID_CUBE_SIZE)
-    {
-        for (float y = Y_MIN; y < Y_MAX; y += GRID_CUBE_SIZE)
-        {
-            for (float z = Z_MIN; z < Z_MAX; z += GRID_CUBE_SIZE)
-            {
-                // iX, iY, iZ are coordinates of the current vertex in grid_cube
-                const auto vertices = MarchingCube(f, x, y, z);
-                std::copy(vertices.begin(), vertices.end(), std::back_inserter(mesh));
-            }
-        }
-    }
-    return mesh;
+    return index == end ? end + 1 : std::min(index + step, end);
 }
 
 static float adapt(float a, float b)
@@ -41,20 +30,8 @@ static float adapt(float a, float b)
     return -a / delta;
 }
 
-Point3FVector MarchingCubes::MarchingCube(std::function<float(float, float, float)> f, float fX, float fY, float fZ)
+void MarchingCubes::polygonise(Point3FVector& mesh, const float CubeValue[], float fX, float fY, float fZ)
 {
-    // vector with all triangles found
-    Point3FVector trianglesMesh;
-
-    float CubeValue[CUBE_VERTICES_NUMBER];
-
-    // Evaluate value of the cube vertex at each point
-    for (int iVertex = 0; iVertex < CUBE_VERTICES_NUMBER; iVertex++)
-    {
-        CubeValue[iVertex] =
-            f(fX + VertexOffset[iVertex][0], fY + VertexOffset[iVertex][1], fZ + VertexOffset[iVertex][2]);
-    }
-
     // Find which vertices are inside of the surface and which are outside
     int iFlagIndex = determineFlag(CubeValue);
 
@@ -64,13 +41,11 @@ Point3FVector MarchingCubes::MarchingCube(std::function<float(float, float, floa
     // If the cube is entirely inside or outside of the surface, then there will be no intersections
     if (iEdgeFlags == 0)
     {
-        return trianglesMesh;
+        return;
     }
 
     // Fill the triangles that were found.  There can be up to five per cube
-    fillFoundTriangles(trianglesMesh, findPointIntersection(iEdgeFlags, CubeValue, fX, fY, fZ), iFlagIndex);
-
-    return trianglesMesh;
+    fillFoundTriangles(mesh, findPointIntersection(iEdgeFlags, CubeValue, fX, fY, fZ), iFlagIndex);
 }
 
 void MarchingCubes::fillFoundTriangles(Point3FVector&       resultEdgeVertex,
@@ -9,8 +9,6 @@
 
 #include "Point.h"
 
-#include <functional>
-
 namespace SPHAlgorithms
 {
 
@@ -23,12 +21,32 @@ class MarchingCubes
 public:
     /**
      * @brief Generates triangles mesh from function
-     * @param f    The function that represents the domain equation
+     * @param f    The function that represents the domain equation, any callable float(float, float, float)
+     * including the shape expressions, which are inlined into the grid traversal
      */
-    static Point3FVector generateMesh(std::function<float(float, float, float)> f);
+    template <class Field> static Point3FVector generateMesh(const Field& f);
+
+    /**
+     * @brief Generates triangles mesh from function, refining only the regions that can contain the surface.
+     * The grid is covered by octree blocks of OCTREE_BLOCK_SIZE grid cubes. The function is sampled on a coarse
+     * lattice of every block, blocks without a sign change are skipped and the rest are split into eight
+     * children down to a single grid cube. Every grid vertex is evaluated at most once.
+     * Surface features thinner than the sampling step of a block may be missed.
+     * @param f    The function that represents the domain equation, any callable float(float, float, float)
+     */
+    template <class Field> static Point3FVector generateMeshAdaptive(const Field& f);
 
 private:
-    static Point3FVector MarchingCube(std::function<float(float, float, float)> f, float fX, float fY, float fZ);
+    template <class Field> class GridSampler;
+
+    template <class Field>
+    static void refineBlock(Point3FVector& mesh, GridSampler<Field>& sampler, int iX, int iY, int iZ, int size);
+
+    template <class Field> static void MarchingCube(Point3FVector& mesh, const Field& f, float fX, float fY, float fZ);
+
+    static int nextSample(int index, int step, int end);
+
+    static void polygonise(Point3FVector& mesh, const float CubeValue[], float fX, float fY, float fZ);
 
     static void
     fillFoundTriangles(Point3FVector& resultEdgeVertex, const Point3FVector& EdgeVertex, const int iFlagIndex);
@@ -41,4 +59,6 @@ private:
 
 } // namespace SPHAlgorithms
 
+#include "MarchingCubes.hpp"
+
 #endif // MARCHING_CUBES_H_43C34465A6ED4DB9B9F2F4C3937BF5DC
@@ -0,0 +1,160 @@
+/**
+ * @file MarchingCubes.hpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "MarchingCubesConfig.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace SPHAlgorithms
+{
+
+template <class Field> Point3FVector MarchingCubes::generateMesh(const Field& f)
+{
+    Point3FVector mesh;
+
+    for (float x = X_MIN; x < X_MAX; x += GRID_CUBE_SIZE)
+    {
+        for (float y = Y_MIN; y < Y_MAX; y += GRID_CUBE_SIZE)
+        {
+            for (float z = Z_MIN; z < Z_MAX; z += GRID_CUBE_SIZE)
+            {
+                // iX, iY, iZ are coordinates of the current vertex in grid_cube
+                MarchingCube(mesh, f, x, y, z);
+            }
+        }
+    }
+    return mesh;
+}
+
+/**
+ * @brief GridSampler caches function values in the grid vertices, so every vertex is evaluated only once.
+ */
+template <class Field> class MarchingCubes::GridSampler
+{
+public:
+    explicit GridSampler(const Field& f)
+        : m_f(f)
+    {
+    }
+
+    float operator()(int iX, int iY, int iZ)
+    {
+        const size_t key =
+            (static_cast<size_t>(iZ) * (GRID_CUBES_NUMBER + 1) + static_cast<size_t>(iY)) * (GRID_CUBES_NUMBER + 1) +
+            static_cast<size_t>(iX);
+
+        const auto it = m_values.find(key);
+        if (it != m_values.end())
+        {
+            return it->second;
+        }
+
+        const float value = m_f(X_MIN + iX * GRID_CUBE_SIZE, Y_MIN + iY * GRID_CUBE_SIZE, Z_MIN + iZ * GRID_CUBE_SIZE);
+        m_values.emplace(key, value);
+
+        return value;
+    }
+
+private:
+    const Field& m_f;
+
+    std::unordered_map<size_t, float> m_values;
+};
+
+template <class Field> Point3FVector MarchingCubes::generateMeshAdaptive(const Field& f)
+{
+    Point3FVector      mesh;
+    GridSampler<Field> sampler(f);
+
+    for (int iX = 0; iX < GRID_CUBES_NUMBER; iX += OCTREE_BLOCK_SIZE)
+    {
+        for (int iY = 0; iY < GRID_CUBES_NUMBER; iY += OCTREE_BLOCK_SIZE)
+        {
+            for (int iZ = 0; iZ < GRID_CUBES_NUMBER; iZ += OCTREE_BLOCK_SIZE)
+            {
+                refineBlock(mesh, sampler, iX, iY, iZ, OCTREE_BLOCK_SIZE);
+            }
+        }
+    }
+    return mesh;
+}
+
+template <class Field>
+void MarchingCubes::refineBlock(Point3FVector& mesh, GridSampler<Field>& sampler, int iX, int iY, int iZ, int size)
+{
+    if (iX >= GRID_CUBES_NUMBER || iY >= GRID_CUBES_NUMBER || iZ >= GRID_CUBES_NUMBER)
+    {
+        return;
+    }
+
+    if (size == 1)
+    {
+        float CubeValue[CUBE_VERTICES_NUMBER];
+
+        for (int iVertex = 0; iVertex < CUBE_VERTICES_NUMBER; iVertex++)
+        {
+            CubeValue[iVertex] = sampler(iX + VertexIndexOffset[iVertex][0],
+                                         iY + VertexIndexOffset[iVertex][1],
+                                         iZ + VertexIndexOffset[iVertex][2]);
+        }
+
+        polygonise(mesh, CubeValue, X_MIN + iX * GRID_CUBE_SIZE, Y_MIN + iY * GRID_CUBE_SIZE,
+                   Z_MIN + iZ * GRID_CUBE_SIZE);
+        return;
+    }
+
+    // Sample the block on a coarse lattice clipped by the grid and look for a sign change
+    const int step = std::max(1, size / OCTREE_BLOCK_SAMPLES);
+    const int endX = std::min(iX + size, GRID_CUBES_NUMBER);
+    const int endY = std::min(iY + size, GRID_CUBES_NUMBER);
+    const int endZ = std::min(iZ + size, GRID_CUBES_NUMBER);
+
+    bool hasInside = false;
+    bool hasOutside = false;
+
+    for (int x = iX; x <= endX; x = nextSample(x, step, endX))
+    {
+        for (int y = iY; y <= endY; y = nextSample(y, step, endY))
+        {
+            for (int z = iZ; z <= endZ; z = nextSample(z, step, endZ))
+            {
+                (sampler(x, y, z) > 0 ? hasInside : hasOutside) = true;
+            }
+        }
+    }
+
+    // The block is entirely inside or outside of the surface
+    if (!(hasInside && hasOutside))
+    {
+        return;
+    }
+
+    const int half = size / 2;
+
+    for (int child = 0; child < CUBE_VERTICES_NUMBER; child++)
+    {
+        refineBlock(mesh, sampler, iX + VertexIndexOffset[child][0] * half, iY + VertexIndexOffset[child][1] * half,
+                    iZ + VertexIndexOffset[child][2] * half, half);
+    }
+}
+
+template <class Field>
+void MarchingCubes::MarchingCube(Point3FVector& mesh, const Field& f, float fX, float fY, float fZ)
+{
+    float CubeValue[CUBE_VERTICES_NUMBER];
+
+    // Evaluate value of the cube vertex at each point
+    for (int iVertex = 0; iVertex < CUBE_VERTICES_NUMBER; iVertex++)
+    {
+        CubeValue[iVertex] =
+            f(fX + VertexOffset[iVertex][0], fY + VertexOffset[iVertex][1], fZ + VertexOffset[iVertex][2]);
+    }
+
+    polygonise(mesh, CubeValue, fX, fY, fZ);
+}
+
+} // namespace SPHAlgorithms
@@ -19,6 +19,12 @@ constexpr int GRID_CUBES_NUMBER = 100;
 // Size of the grid cube
 const constexpr float GRID_CUBE_SIZE = CUBE_SIZE / GRID_CUBES_NUMBER;
 
+// Edge of the coarsest octree block, in grid cubes, used by the adaptive mesh generation
+constexpr int OCTREE_BLOCK_SIZE = 16;
+
+// Number of sampling intervals along an octree block edge used to look for a sign change
+constexpr int OCTREE_BLOCK_SAMPLES = 8;
+
 // The dimensions of the grid [X_MIN, X_MAX] x [Y_MIN, Y_MAX] x [Z_MIN, Z_MAX]
 constexpr float X_MIN = 0.f;
 constexpr float X_MAX = CUBE_SIZE;
@@ -46,6 +52,10 @@ constexpr float VertexOffset[CUBE_VERTICES_NUMBER][CUBE_DIMENSION] = {{0.0, 0.0,
                                                                       {GRID_CUBE_SIZE, GRID_CUBE_SIZE, GRID_CUBE_SIZE},
                                                                       {0.0, GRID_CUBE_SIZE, GRID_CUBE_SIZE}};
 
+// VertexIndexOffset lists the grid indices offsets of the vertices, for each grid cube in the grid
+constexpr int VertexIndexOffset[CUBE_VERTICES_NUMBER][CUBE_DIMENSION] = {
+    {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+
 // EdgeConnection lists the index of the endpoint vertices for each of the 12 edges of the cube
 constexpr int EdgeConnection[CUBE_EDGES_NUMBER][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
                                                       {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
@@ -10,6 +10,10 @@
 #include "Point.h"
 #include "Defines.h"
 #include "Area.h"
+#include "Periodicity.h"
+
+#include <cstdint>
+#include <unordered_map>
 
 namespace SPHAlgorithms
 {
@@ -69,66 +73,111 @@ private:
 
 // ---------------------------
 
+/**
+* @brief NeighboursSearch3D class finds neighbours in 3D.
+* The dense grid allocates all the boxes of the volume cuboid up front.
+* The hashed grid keeps only the boxes occupied by the points in the hash table, so its cost is
+* proportional to the amount of the occupied boxes and the points may leave the volume cuboid, which only
+* defines the origin of the boxes. The nearby boxes of the hashed grid are found by adding the key offsets.
+* The positions of the points are of double or float precision, the differences are computed in their precision.
+*/
 template <class T> class NeighboursSearch3D
 {
     friend class TestEnvironment::NeighboursSearchTestSuite;
     
 public:
 
-    explicit NeighboursSearch3D(const Volume& volume, double radius, double eps);
+    enum GridType { dense, hashed };
+
+    explicit NeighboursSearch3D(const Volume& volume, double radius, double eps, GridType gridType = dense);
 
     ~NeighboursSearch3D();
 
     void search(T& points);
 
-    enum BoxType { outerCorner, outerLongitual, outerCenter,
-                   innerCorner, innerLongitual, innerCenter };
+    /**
+    * @brief Searches the neighbours of the points and their static neighbours within the radius. The static
+    * neighbours of every point are listed in the order of the boxes, the static points get no neighbours.
+    */
+    void search(T& points, VectorOfSizetVectors& staticNeighbours);
+
+    /**
+    * @brief Puts the static points into the boxes once, e.g. the boundary particles. They are not binned again
+    * by the searches, so only the moving points are re-binned every step. The static points are any vector of
+    * the items with the position. The static points are supported by the dense grid only.
+    */
+    template <class StaticPoints> void setStaticPoints(const StaticPoints& staticPoints);
+
+    size_t getStaticPointsNumber() const;
+
+    /**
+    * @brief Sets the periodic axes of the volume cuboid. The stencil of the boxes at the faces of the periodic axis
+    * wraps around to the opposite face, and the distances are measured between the nearest images, so the points
+    * near the opposite faces are neighbours. The periodic axes are supported by the dense grid of the volume
+    * without a domain only.
+    */
+    void setPeriodicity(const Periodicity& periodicity);
+
+    const Periodicity& getPeriodicity() const;
+
+    /**
+    * @brief Returns the points put by the last search into the boxes which overlap the cuboid.
+    * The cuboid is expanded by one box, so the points which moved less than the radius since the search
+    * are found as well.
+    */
+    SizetVector findPointsNearCuboid(const Cuboid& cuboid) const;
+
+    /**
+    * @brief Returns the indexes of the boxes which overlap the cuboid expanded by one box.
+    * The hashed grid returns only the occupied boxes, their indexes are valid until the next search.
+    */
+    SizetVector findBoxesNearCuboid(const Cuboid& cuboid) const;
+
+    /**
+    * @brief Returns the points put into the box by the last search.
+    */
+    const SizetVector& getPointsInBox(size_t boxIndex) const;
+
+    GridType getGridType() const;
+
+    /**
+    * @brief The incremental dense grid keeps the box of every point between the searches and moves only
+    * the points which changed their boxes, while the amount of points is the same. The hashed grid ignores it.
+    */
+    void setIncremental(bool isIncremental);
+
+    /**
+    * @brief Returns the amount of points put into other boxes by the last search.
+    */
+    size_t getMovedPointsNumber() const;
 
 private:
 
     void insertPointsIntoBoxes(const T& points);
 
-    void findNearbyBoxes();
+    void rebinPointsIntoBoxes(const T& points);
+
+    template <class Position> size_t getBoxIndex(const Position& position) const;
+
+    void insertPointsIntoHashedBoxes(const T& points);
 
-    SizetVector getComponentsOfBoxIndex(const size_t boxIndex);
-
-    BoxType getBoxType(const SizetVector& components);
-
-    void defineNearbyBoxes(const BoxType boxType,
-                           const SizetVector& components,
-                           const size_t boxIndex);
-
-    void addNearbyBoxesFor(const bool isLeft,
-                           const bool isRight,
-                           const bool isTop,
-                           const bool isBottom,
-                           const SizetVector& components,
-                           const size_t boxIndex);
-
-    void addForTopLeft(const SizetVector& components,
-                       const size_t boxIndex);
-    void addForTopRight(const SizetVector& components,
-                        const size_t boxIndex);
-    void addForBottomLeft(const SizetVector& components,
-                          const size_t boxIndex);
-    void addForBottomRight(const SizetVector& components,
-                           const size_t boxIndex);
-
-    void addForCenter(const SizetVector& components,
-                      const size_t boxIndex);
-
-    void addForLeft(const SizetVector& components,
-                    const size_t boxIndex);
-    void addForRight(const SizetVector& components,
-                     const size_t boxIndex);
-    void addForTop(const SizetVector& components,
-                   const size_t boxIndex);
-    void addForBottom(const SizetVector& components,
-                      const size_t boxIndex);
-
-    void addForBack(const size_t boxIndex);
-    void addForFront(const size_t boxIndex);
-    void addForMiddle(const size_t boxIndex);
+    void searchInHashedBoxes(T& points);
+
+    SizetVector findHashedBoxesNearCuboid(const Cuboid& cuboid) const;
+
+    /**
+    * @brief Returns the box components of the point along x, y and z axis, they can be negative.
+    * The position is either of double or of float precision.
+    */
+    template <class Position> void getBoxComponents(const Position& position, int64_t components[3]) const;
+
+    static uint64_t getBoxKey(const int64_t components[3]);
+
+    void findActiveBoxes();
+
+    void getComponentsOfBoxIndex(size_t boxIndex, size_t components[3]) const;
+
+    template <class Visitor> void forEachNearbyBox(size_t boxIndex, Visitor&& visit) const;
 
 private:
 
@@ -140,14 +189,90 @@ private:
 
     VectorOfSizetVectors m_boxes;
 
-    VectorOfSizetVectors m_nearbyBoxes;
+    SizetVector m_activeBoxes; // the boxes which intersect the domain of the volume
 
     size_t m_boxesNumber;
 
     size_t m_pointsSize; // the amount of points
 
     Cuboid m_cuboid;
+
+    size_t m_axisBoxesNumber[3]; // the amount of boxes along x, y and z axis
+
+    ptrdiff_t m_stencilOffsets[26]; // the index offsets of the nearby boxes of the inner box
+
+    GridType m_gridType;
+
+    std::unordered_map<uint64_t, size_t> m_hashedBoxes; // the key of the occupied box to its index in m_boxes
+
+    std::vector<uint64_t> m_boxKeys; // the keys of the occupied boxes of the hashed grid
+
+    bool m_isIncremental;
+
+    SizetVector m_pointBoxes; // the box of every point of the incremental grid
+
+    SizetVector m_pointSlots; // the position of every point in its box
+
+    size_t m_movedPointsNumber;
+
+    SizetVector m_staticBoxOffsets; // the first static point of every box in m_staticPoints and the amount at the end
+
+    SizetVector m_staticPoints; // the static points sorted by their boxes
+
+    std::vector<Point3D> m_staticPositions; // the positions of m_staticPoints, they are read box by box
+
+    Periodicity m_periodicity;
 };
+
+// ---------------------------
+
+/**
+* @brief MultiLevelNeighboursSearch3D class finds neighbours of the points with different support radii.
+* Every point is put into the hashed grid of the smallest level whose box size is not less than its support
+* radius, the last level takes the larger points as well. The points are neighbours if the distance between them
+* does not exceed the symmetrized support radius h_ij = (h_i + h_j) / 2, so the small points search only the boxes
+* within h_ij of the every level instead of the boxes of the largest radius.
+* The points are required to have the supportRadius field.
+*/
+template <class T> class MultiLevelNeighboursSearch3D
+{
+    friend class TestEnvironment::NeighboursSearchTestSuite;
+
+public:
+
+    /**
+    * @param volume        The volume whose cuboid defines the origin of the boxes
+    * @param levelRadii    The box sizes of the levels, they are sorted in ascending order
+    */
+    explicit MultiLevelNeighboursSearch3D(const Volume& volume, const std::vector<double>& levelRadii);
+
+    void search(T& points);
+
+    size_t getLevelsNumber() const;
+
+    /**
+    * @brief Returns the level of the point with the support radius.
+    */
+    size_t getLevel(double supportRadius) const;
+
+private:
+
+    void insertPointsIntoLevels(const T& points);
+
+    template <class Position>
+    void getBoxComponents(const Position& position, double boxSize, int64_t components[3]) const;
+
+private:
+
+    Point3D m_origin;
+
+    std::vector<double> m_levelRadii;
+
+    std::vector<double> m_levelSupportRadii; // the largest support radius of the points of every level
+
+    std::vector<std::unordered_map<uint64_t, SizetVector>> m_levelBoxes;
+};
+
 } //SPHAlgorithms
 
 #include "NeighboursSearch.hpp"
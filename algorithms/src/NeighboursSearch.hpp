@@ -9,6 +9,8 @@
 
 #include "NeighboursSearch.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cfloat>
 #include <cmath>
 
@@ -206,32 +208,68 @@ template <class T> void NeighboursSearch<T>::findNearbyBoxes()
 
 // ---------------------------
 
-static size_t normalizedCuboidWidth;
-static size_t normalizedCuboidLength;
-static size_t normalizedCuboidHeight;
+namespace
+{
+// the box components of the hashed grid are biased and packed into the key by 21 bits
+const int64_t HashedBoxBits = 21;
+const int64_t HashedBoxBias = int64_t(1) << (HashedBoxBits - 1);
+const uint64_t HashedBoxMask = (uint64_t(1) << HashedBoxBits) - 1u;
+
+inline uint64_t packBoxKey(const int64_t components[3])
+{
+    uint64_t key = 0u;
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+        key |= (static_cast<uint64_t>(components[axis] + HashedBoxBias) & HashedBoxMask) << (HashedBoxBits * axis);
+
+    return key;
+}
+} // namespace
 
 template <class T>
-NeighboursSearch3D<T>::NeighboursSearch3D(const Volume& volume, double radius, double eps)
+NeighboursSearch3D<T>::NeighboursSearch3D(const Volume& volume, double radius, double eps, GridType gridType)
     : m_volume(volume)
     , m_radius(radius)
     , m_eps(eps)
     , m_boxes(VectorOfSizetVectors())
+    , m_boxesNumber(0)
+    , m_pointsSize(0)
+    , m_gridType(gridType)
+    , m_isIncremental(false)
+    , m_movedPointsNumber(0)
     {
         const Cuboid cuboid = m_volume.getBoundingCuboid();
 
         m_cuboid = cuboid;
 
-        normalizedCuboidWidth = static_cast<size_t>(m_cuboid.width / m_radius);
-        normalizedCuboidLength = static_cast<size_t>(m_cuboid.length / m_radius);
-        normalizedCuboidHeight = static_cast<size_t>(m_cuboid.height / m_radius);
+        // the boxes of the hashed grid are created by the search
+        if (m_gridType == hashed)
+        {
+            std::fill(m_axisBoxesNumber, m_axisBoxesNumber + 3, size_t(0));
+            std::fill(m_stencilOffsets, m_stencilOffsets + 26, ptrdiff_t(0));
+            return;
+        }
 
-        m_boxesNumber = static_cast<size_t>(normalizedCuboidWidth *
-                                            normalizedCuboidLength *
-                                            normalizedCuboidHeight);
+        m_axisBoxesNumber[0] = static_cast<size_t>(m_cuboid.width / m_radius);
+        m_axisBoxesNumber[1] = static_cast<size_t>(m_cuboid.length / m_radius);
+        m_axisBoxesNumber[2] = static_cast<size_t>(m_cuboid.height / m_radius);
+
+        m_boxesNumber = m_axisBoxesNumber[0] * m_axisBoxesNumber[1] * m_axisBoxesNumber[2];
         m_boxes.resize(m_boxesNumber);
-        m_nearbyBoxes.resize(m_boxesNumber);
 
-        findNearbyBoxes();
+        // the index offsets of the nearby boxes in the order of the numbering
+        const ptrdiff_t strides[3] = {1,
+                                      static_cast<ptrdiff_t>(m_axisBoxesNumber[0]),
+                                      static_cast<ptrdiff_t>(m_axisBoxesNumber[0] * m_axisBoxesNumber[1])};
+        size_t offsetIndex = 0u;
+
+        for (ptrdiff_t dZ = -1; dZ <= 1; dZ++)
+            for (ptrdiff_t dY = -1; dY <= 1; dY++)
+                for (ptrdiff_t dX = -1; dX <= 1; dX++)
+                    if (dX != 0 || dY != 0 || dZ != 0)
+                        m_stencilOffsets[offsetIndex++] = dX * strides[0] + dY * strides[1] + dZ * strides[2];
+
+        findActiveBoxes();
     }
 
 template <class T> NeighboursSearch3D<T>::~NeighboursSearch3D() = default;
@@ -241,39 +279,384 @@ template <class T> NeighboursSearch3D<T>::~NeighboursSearch3D() = default;
  * 1. Clear all neighbours;
  * 2. Put every point in box;
  * 3. Look for neighbour points for every point in every box;
- * 4. Look for neighbour points for every point in neighbour boxes;
+ * 4. Look for neighbour points for every point in the nearby boxes of the 3x3x3 stencil;
  */
 template <class T> void NeighboursSearch3D<T>::search(T& points)
 {
     // 1
     for (size_t i = 0; i < points.size(); i++)
         points[i].neighbours.clear();
+
+    if (m_gridType == hashed)
+    {
+        insertPointsIntoHashedBoxes(points);
+        searchInHashedBoxes(points);
+        return;
+    }
     // 2
     insertPointsIntoBoxes(points);
-    // 3
-    for (size_t boxIndex = 0; boxIndex < m_boxes.size(); boxIndex++)
-        for (size_t pointIndex = 0; pointIndex < m_boxes[boxIndex].size(); pointIndex++)
-            for (size_t nearbyPointIndex = 0; nearbyPointIndex < m_boxes[boxIndex].size(); nearbyPointIndex++)
+
+    const double radiusSqr = m_radius * m_radius;
+
+    for (const size_t boxIndex : m_activeBoxes)
+    {
+        const SizetVector& boxPoints = m_boxes[boxIndex];
+
+        if (boxPoints.empty())
+            continue;
+        // 3
+        for (size_t pointIndex = 0; pointIndex < boxPoints.size(); pointIndex++)
+            for (size_t nearbyPointIndex = 0; nearbyPointIndex < boxPoints.size(); nearbyPointIndex++)
                 if (pointIndex != nearbyPointIndex)
                 {
-                    Point3D difference = points[m_boxes[boxIndex][pointIndex]].position -
-                                         points[m_boxes[boxIndex][nearbyPointIndex]].position;
-                    if (difference.calcNormSqr() <= pow(m_radius, 2))
-                        points[m_boxes[boxIndex][pointIndex]].neighbours.push_back(m_boxes[boxIndex][nearbyPointIndex]);
+                    const auto difference = m_periodicity.calcMinimumImage(
+                        points[boxPoints[pointIndex]].position - points[boxPoints[nearbyPointIndex]].position);
+                    if (difference.calcNormSqr() <= radiusSqr)
+                        points[boxPoints[pointIndex]].neighbours.push_back(boxPoints[nearbyPointIndex]);
                 }
-    // 4
-    for (size_t boxIndex = 0; boxIndex < m_boxes.size(); boxIndex++)
-        for (size_t pointIndex = 0; pointIndex < m_boxes[boxIndex].size(); pointIndex++)
-            for (size_t nearbyBoxIndex = 0; nearbyBoxIndex < m_nearbyBoxes[boxIndex].size(); nearbyBoxIndex++)
-                for (size_t nearbyPointIndex = 0; nearbyPointIndex < m_boxes[m_nearbyBoxes[boxIndex][nearbyBoxIndex]].size(); nearbyPointIndex++)
+        // 4
+        forEachNearbyBox(boxIndex, [&](size_t nearbyBoxIndex) {
+            const SizetVector& nearbyPoints = m_boxes[nearbyBoxIndex];
+
+            for (const size_t pointIndex : boxPoints)
+                for (const size_t nearbyPointIndex : nearbyPoints)
                 {
-                    Point3D difference = points[m_boxes[boxIndex][pointIndex]].position -
-                                         points[m_boxes[m_nearbyBoxes[boxIndex][nearbyBoxIndex]][nearbyPointIndex]].position;
-                    if (difference.calcNormSqr() - pow(m_radius, 2) <= DBL_EPSILON)
-                        points[m_boxes[boxIndex][pointIndex]]
-                            .neighbours
-                            .push_back(m_boxes[m_nearbyBoxes[boxIndex][nearbyBoxIndex]][nearbyPointIndex]);
+                    const auto difference = m_periodicity.calcMinimumImage(points[pointIndex].position -
+                                                                           points[nearbyPointIndex].position);
+                    if (difference.calcNormSqr() - radiusSqr <= DBL_EPSILON)
+                        points[pointIndex].neighbours.push_back(nearbyPointIndex);
                 }
+        });
+    }
+}
+
+/**
+ * @brief The dynamic points are searched by search(points), then the static points of the 3x3x3 stencil are
+ * tested for the points of every box. The static points of a box are stored together, so they are read
+ * sequentially.
+ */
+template <class T> void NeighboursSearch3D<T>::search(T& points, VectorOfSizetVectors& staticNeighbours)
+{
+    search(points);
+
+    staticNeighbours.resize(points.size());
+
+    for (size_t i = 0; i < points.size(); i++)
+        staticNeighbours[i].clear();
+
+    if (m_staticPoints.empty())
+        return;
+
+    const double radiusSqr = m_radius * m_radius;
+
+    for (const size_t boxIndex : m_activeBoxes)
+    {
+        const SizetVector& boxPoints = m_boxes[boxIndex];
+
+        if (boxPoints.empty())
+            continue;
+
+        const auto visitStaticBox = [&](size_t staticBoxIndex) {
+            const size_t firstSlot = m_staticBoxOffsets[staticBoxIndex];
+            const size_t lastSlot = m_staticBoxOffsets[staticBoxIndex + 1u];
+
+            for (const size_t pointIndex : boxPoints)
+            {
+                const auto& position = points[pointIndex].position;
+                const Point3D pointPosition(position.x, position.y, position.z);
+
+                for (size_t slot = firstSlot; slot < lastSlot; slot++)
+                {
+                    const Point3D difference = m_periodicity.calcMinimumImage(pointPosition - m_staticPositions[slot]);
+                    if (difference.calcNormSqr() - radiusSqr <= DBL_EPSILON)
+                        staticNeighbours[pointIndex].push_back(m_staticPoints[slot]);
+                }
+            }
+        };
+
+        visitStaticBox(boxIndex);
+        forEachNearbyBox(boxIndex, visitStaticBox);
+    }
+}
+
+/**
+ * @brief The static points are sorted by their boxes with the counting sort.
+ */
+template <class T>
+template <class StaticPoints>
+void NeighboursSearch3D<T>::setStaticPoints(const StaticPoints& staticPoints)
+{
+    assert(m_gridType == dense || staticPoints.empty());
+
+    m_staticBoxOffsets.clear();
+    m_staticPoints.clear();
+    m_staticPositions.clear();
+
+    if (staticPoints.empty())
+        return;
+
+    SizetVector pointBoxes(staticPoints.size());
+    m_staticBoxOffsets.assign(m_boxesNumber + 1u, 0u);
+
+    for (size_t i = 0; i < staticPoints.size(); i++)
+    {
+        pointBoxes[i] = getBoxIndex(staticPoints[i].position);
+        m_staticBoxOffsets[pointBoxes[i] + 1u]++;
+    }
+
+    for (size_t boxIndex = 0; boxIndex < m_boxesNumber; boxIndex++)
+        m_staticBoxOffsets[boxIndex + 1u] += m_staticBoxOffsets[boxIndex];
+
+    SizetVector nextSlots(m_staticBoxOffsets.begin(), m_staticBoxOffsets.end() - 1);
+
+    m_staticPoints.resize(staticPoints.size());
+    m_staticPositions.resize(staticPoints.size());
+
+    for (size_t i = 0; i < staticPoints.size(); i++)
+    {
+        const size_t slot = nextSlots[pointBoxes[i]]++;
+        const auto& position = staticPoints[i].position;
+
+        m_staticPoints[slot] = i;
+        m_staticPositions[slot] = Point3D(position.x, position.y, position.z);
+    }
+}
+
+template <class T> size_t NeighboursSearch3D<T>::getStaticPointsNumber() const
+{
+    return m_staticPoints.size();
+}
+
+template <class T> void NeighboursSearch3D<T>::setPeriodicity(const Periodicity& periodicity)
+{
+    assert(m_gridType == dense || !periodicity.hasPeriodicAxes());
+    assert(!m_volume.hasDomain() || !periodicity.hasPeriodicAxes());
+
+    m_periodicity = periodicity;
+}
+
+template <class T> const Periodicity& NeighboursSearch3D<T>::getPeriodicity() const
+{
+    return m_periodicity;
+}
+
+template <class T> SizetVector NeighboursSearch3D<T>::findPointsNearCuboid(const Cuboid& cuboid) const
+{
+    SizetVector points;
+
+    for (const size_t boxIndex : findBoxesNearCuboid(cuboid))
+        points.insert(points.end(), m_boxes[boxIndex].begin(), m_boxes[boxIndex].end());
+
+    return points;
+}
+
+template <class T> SizetVector NeighboursSearch3D<T>::findBoxesNearCuboid(const Cuboid& cuboid) const
+{
+    if (m_gridType == hashed)
+        return findHashedBoxesNearCuboid(cuboid);
+
+    // the coordinates relative to the volume
+    const double start[3] = {cuboid.startingPoint.x - m_cuboid.startingPoint.x,
+                             cuboid.startingPoint.y - m_cuboid.startingPoint.y,
+                             cuboid.startingPoint.z - m_cuboid.startingPoint.z};
+    const double end[3] = {start[0] + cuboid.width, start[1] + cuboid.length, start[2] + cuboid.height};
+    const size_t* boxesNumber = m_axisBoxesNumber;
+
+    size_t first[3];
+    size_t last[3];
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        const double firstBox = std::floor(start[axis] / m_radius) - 1.;
+        const double lastBox = std::floor(end[axis] / m_radius) + 1.;
+
+        // the cuboid is outside of the volume
+        if (lastBox < 0. || firstBox >= static_cast<double>(boxesNumber[axis]))
+            return SizetVector();
+
+        first[axis] = static_cast<size_t>(std::max(firstBox, 0.));
+        last[axis] = std::min(static_cast<size_t>(lastBox), boxesNumber[axis] - 1u);
+    }
+
+    SizetVector boxes;
+
+    for (size_t heightIndex = first[2]; heightIndex <= last[2]; heightIndex++)
+        for (size_t lengthIndex = first[1]; lengthIndex <= last[1]; lengthIndex++)
+            for (size_t widthIndex = first[0]; widthIndex <= last[0]; widthIndex++)
+                boxes.push_back(widthIndex + (lengthIndex + heightIndex * boxesNumber[1]) * boxesNumber[0]);
+
+    return boxes;
+}
+
+template <class T> const SizetVector& NeighboursSearch3D<T>::getPointsInBox(size_t boxIndex) const
+{
+    return m_boxes[boxIndex];
+}
+
+template <class T> typename NeighboursSearch3D<T>::GridType NeighboursSearch3D<T>::getGridType() const
+{
+    return m_gridType;
+}
+
+/**
+ * @brief The box components are counted from the starting point of the volume cuboid and clamped by the range
+ * of the hashed keys.
+ */
+template <class T>
+template <class Position>
+void NeighboursSearch3D<T>::getBoxComponents(const Position& position, int64_t components[3]) const
+{
+    const double coordinates[3] = {position.x - m_cuboid.startingPoint.x, position.y - m_cuboid.startingPoint.y,
+                                   position.z - m_cuboid.startingPoint.z};
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        const double component = std::floor(coordinates[axis] / m_radius);
+
+        // the nearby boxes of the clamped box are in the range as well
+        components[axis] = static_cast<int64_t>(std::min(std::max(component, static_cast<double>(2 - HashedBoxBias)),
+                                                          static_cast<double>(HashedBoxBias - 2)));
+    }
+}
+
+template <class T> uint64_t NeighboursSearch3D<T>::getBoxKey(const int64_t components[3])
+{
+    return packBoxKey(components);
+}
+
+/**
+ * @brief Only the occupied boxes are created, the storage of the points vectors is reused between the searches.
+ */
+template <class T> void NeighboursSearch3D<T>::insertPointsIntoHashedBoxes(const T& points)
+{
+    for (size_t i = 0; i < m_boxesNumber; i++)
+        m_boxes[i].clear();
+
+    m_hashedBoxes.clear();
+    m_boxKeys.clear();
+
+    m_pointsSize = points.size();
+
+    size_t boxesNumber = 0u;
+
+    for (size_t i = 0; i < m_pointsSize; i++)
+    {
+        int64_t components[3];
+        getBoxComponents(points[i].position, components);
+
+        const auto box = m_hashedBoxes.emplace(getBoxKey(components), boxesNumber);
+
+        if (box.second)
+        {
+            if (boxesNumber == m_boxes.size())
+                m_boxes.emplace_back();
+
+            m_boxKeys.push_back(box.first->first);
+            ++boxesNumber;
+        }
+
+        m_boxes[box.first->second].push_back(i);
+    }
+
+    m_boxes.resize(boxesNumber);
+    m_boxesNumber = boxesNumber;
+}
+
+/**
+ * @brief The keys of the 27 boxes around the box differ from its key by the fixed offsets, because
+ * the components are packed into the separate bits. The box itself is visited first.
+ */
+template <class T> void NeighboursSearch3D<T>::searchInHashedBoxes(T& points)
+{
+    uint64_t keyOffsets[27];
+    size_t offsetsNumber = 0u;
+
+    keyOffsets[offsetsNumber++] = 0u;
+
+    for (int64_t dZ = -1; dZ <= 1; dZ++)
+        for (int64_t dY = -1; dY <= 1; dY++)
+            for (int64_t dX = -1; dX <= 1; dX++)
+                if (dX != 0 || dY != 0 || dZ != 0)
+                    keyOffsets[offsetsNumber++] = static_cast<uint64_t>(
+                        dX + dY * (int64_t(1) << HashedBoxBits) + dZ * (int64_t(1) << (2 * HashedBoxBits)));
+
+    const double radiusSqr = m_radius * m_radius;
+
+    for (size_t boxIndex = 0; boxIndex < m_boxesNumber; boxIndex++)
+        for (const uint64_t keyOffset : keyOffsets)
+        {
+            const auto nearbyBox = m_hashedBoxes.find(m_boxKeys[boxIndex] + keyOffset);
+
+            if (nearbyBox == m_hashedBoxes.end())
+                continue;
+
+            const SizetVector& nearbyPoints = m_boxes[nearbyBox->second];
+
+            for (const size_t pointIndex : m_boxes[boxIndex])
+                for (const size_t nearbyPointIndex : nearbyPoints)
+                    if (pointIndex != nearbyPointIndex)
+                    {
+                        const auto difference = points[pointIndex].position - points[nearbyPointIndex].position;
+                        if (difference.calcNormSqr() - radiusSqr <= DBL_EPSILON)
+                            points[pointIndex].neighbours.push_back(nearbyPointIndex);
+                    }
+        }
+}
+
+template <class T> SizetVector NeighboursSearch3D<T>::findHashedBoxesNearCuboid(const Cuboid& cuboid) const
+{
+    int64_t first[3];
+    int64_t last[3];
+    getBoxComponents(cuboid.startingPoint, first);
+    getBoxComponents(cuboid.startingPoint + Point3D(cuboid.width, cuboid.length, cuboid.height), last);
+
+    size_t rangeBoxesNumber = 1u;
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        --first[axis];
+        ++last[axis];
+        rangeBoxesNumber *= static_cast<size_t>(last[axis] - first[axis] + 1);
+    }
+
+    SizetVector boxes;
+
+    // the large cuboid is checked against the occupied boxes
+    if (rangeBoxesNumber > m_boxesNumber)
+    {
+        for (size_t boxIndex = 0; boxIndex < m_boxesNumber; boxIndex++)
+        {
+            bool isInside = true;
+
+            for (size_t axis = 0u; axis < 3u; ++axis)
+            {
+                const int64_t component =
+                    static_cast<int64_t>((m_boxKeys[boxIndex] >> (HashedBoxBits * axis)) & HashedBoxMask) -
+                    HashedBoxBias;
+                isInside = isInside && component >= first[axis] && component <= last[axis];
+            }
+
+            if (isInside)
+                boxes.push_back(boxIndex);
+        }
+
+        std::sort(boxes.begin(), boxes.end());
+        return boxes;
+    }
+
+    int64_t components[3];
+
+    for (components[2] = first[2]; components[2] <= last[2]; components[2]++)
+        for (components[1] = first[1]; components[1] <= last[1]; components[1]++)
+            for (components[0] = first[0]; components[0] <= last[0]; components[0]++)
+            {
+                const auto box = m_hashedBoxes.find(getBoxKey(components));
+
+                if (box != m_hashedBoxes.end())
+                    boxes.push_back(box->second);
+            }
+
+    return boxes;
 }
 
 /**
@@ -293,42 +676,142 @@ template <class T> void NeighboursSearch3D<T>::search(T& points)
  */
 template <class T> void NeighboursSearch3D<T>::insertPointsIntoBoxes(const T& points)
 {
+    // the same points are moved between the boxes
+    if (m_isIncremental && m_pointBoxes.size() == points.size())
+    {
+        rebinPointsIntoBoxes(points);
+        return;
+    }
+
     for (size_t i = 0; i < m_boxesNumber; i++)
         m_boxes[i].clear();
 
     m_pointsSize = points.size();
+    m_movedPointsNumber = m_pointsSize;
+
+    if (m_isIncremental)
+    {
+        m_pointBoxes.resize(m_pointsSize);
+        m_pointSlots.resize(m_pointsSize);
+    }
 
     for (size_t i = 0; i < m_pointsSize; i++)
     {
-        // The Formula is created manually using height layers approach
+        const size_t boxIndex = getBoxIndex(points[i].position);
 
-        auto widthOffset = static_cast<size_t>(points[i].position.x / m_radius);
-        size_t lengthOffset = static_cast<size_t>(points[i].position.y / m_radius) *
-                              normalizedCuboidWidth;
-        size_t heightOffset = static_cast<size_t>(points[i].position.z / m_radius) *
-                              normalizedCuboidLength * normalizedCuboidWidth;
+        m_boxes[boxIndex].push_back(i);
 
-        if (std::abs(points[i].position.x - m_cuboid.width) < m_eps)
-            widthOffset -= 1;
+        if (m_isIncremental)
+        {
+            m_pointBoxes[i] = boxIndex;
+            m_pointSlots[i] = m_boxes[boxIndex].size() - 1u;
+        }
+    }
+}
+
+/**
+ * @brief Only the points which left their boxes are moved. The point is removed from its box by replacing it
+ * with the last point of the box, so the boxes are not kept sorted.
+ */
+template <class T> void NeighboursSearch3D<T>::rebinPointsIntoBoxes(const T& points)
+{
+    m_movedPointsNumber = 0u;
+
+    for (size_t i = 0; i < m_pointsSize; i++)
+    {
+        const size_t boxIndex = getBoxIndex(points[i].position);
 
-        if (std::abs(points[i].position.y - m_cuboid.length) < m_eps)
-            lengthOffset -= normalizedCuboidLength;
+        if (boxIndex == m_pointBoxes[i])
+            continue;
 
-        if (std::abs(points[i].position.z - m_cuboid.height) < m_eps)
-            heightOffset -= normalizedCuboidLength * normalizedCuboidWidth;
+        SizetVector& previousBox = m_boxes[m_pointBoxes[i]];
+        const size_t lastPoint = previousBox.back();
 
-        size_t boxIndex = widthOffset + lengthOffset + heightOffset;
+        previousBox[m_pointSlots[i]] = lastPoint;
+        m_pointSlots[lastPoint] = m_pointSlots[i];
+        previousBox.pop_back();
 
         m_boxes[boxIndex].push_back(i);
+        m_pointBoxes[i] = boxIndex;
+        m_pointSlots[i] = m_boxes[boxIndex].size() - 1u;
+
+        ++m_movedPointsNumber;
     }
 }
 
 /**
- * @brief This method classifies boxes by types and fills nearby boxes for every box.
- * There are two types of layers: outer and inner;
- * And three types of boxes for every layer: corner, longitual and center.
- *
- * Considering this, there are six types of boxes with fixed amout of neighbours:
+ * @brief The points on the far borders and outside of the volume are put into the border boxes.
+ */
+template <class T>
+template <class Position>
+size_t NeighboursSearch3D<T>::getBoxIndex(const Position& position) const
+{
+    // The Formula is created manually using height layers approach
+
+    int64_t components[3];
+    getBoxComponents(position, components);
+
+    size_t clampedComponents[3];
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+        clampedComponents[axis] = static_cast<size_t>(
+            std::min<int64_t>(std::max<int64_t>(components[axis], 0), m_axisBoxesNumber[axis] - 1));
+
+    return clampedComponents[0] +
+           (clampedComponents[1] + clampedComponents[2] * m_axisBoxesNumber[1]) * m_axisBoxesNumber[0];
+}
+
+template <class T> void NeighboursSearch3D<T>::setIncremental(bool isIncremental)
+{
+    m_isIncremental = isIncremental && m_gridType == dense;
+    m_pointBoxes.clear();
+    m_pointSlots.clear();
+}
+
+template <class T> size_t NeighboursSearch3D<T>::getMovedPointsNumber() const
+{
+    return m_movedPointsNumber;
+}
+
+/**
+ * @brief This method collects the boxes which intersect the domain of the volume.
+ * The points are kept inside of the domain by the boundary collisions, so the other boxes stay empty
+ * and they are not visited by the search.
+ */
+template <class T> void NeighboursSearch3D<T>::findActiveBoxes()
+{
+    m_activeBoxes.clear();
+
+    for (size_t boxIndex = 0; boxIndex < m_boxesNumber; boxIndex++)
+    {
+        size_t components[3];
+        getComponentsOfBoxIndex(boxIndex, components);
+
+        const Cuboid box(m_cuboid.startingPoint + Point3D(components[0] * m_radius,
+                                                          components[1] * m_radius,
+                                                          components[2] * m_radius),
+                         m_radius, m_radius, m_radius);
+
+        if (m_volume.intersectsDomain(expandCuboid(box, m_eps)))
+            m_activeBoxes.push_back(boxIndex);
+    }
+}
+
+/**
+ * @brief This method returns components (width, length and height) of the box index.
+ */
+template <class T> void NeighboursSearch3D<T>::getComponentsOfBoxIndex(size_t boxIndex, size_t components[3]) const
+{
+    components[0] = boxIndex % m_axisBoxesNumber[0];
+    components[1] = (boxIndex / m_axisBoxesNumber[0]) % m_axisBoxesNumber[1];
+    components[2] = boxIndex / (m_axisBoxesNumber[0] * m_axisBoxesNumber[1]);
+}
+
+/**
+ * @brief This method visits the nearby boxes of the 3x3x3 stencil around the box, the box itself is skipped.
+ * The inner boxes have all 26 nearby boxes, which are found by the precomputed index offsets.
+ * The stencil of the border boxes wraps around along the periodic axes, each box is visited once if the axis
+ * has less than three boxes. Along the other axes it is clamped by the grid, so they have fewer nearby boxes:
  * - outer-corner: 7;
  * - outer-longitual: 11;
  * - outer-center: 17;
@@ -345,354 +828,189 @@ template <class T> void NeighboursSearch3D<T>::insertPointsIntoBoxes(const T& po
  *
  *     Length 0             Length 1             Length 2
  */
-
-template <class T> void NeighboursSearch3D<T>::findNearbyBoxes()
-{
-    for (size_t boxIndex = 0; boxIndex < m_boxes.size(); boxIndex++)
-    {
-        const SizetVector boxComponents = getComponentsOfBoxIndex(boxIndex);
-        BoxType boxType = getBoxType(boxComponents);
-        defineNearbyBoxes(boxType, boxComponents, boxIndex);
-    }
-}
-
-/**
- * @brief This method returns array of components (width, length and height) for box index.
- */
-
-template <class T> SizetVector NeighboursSearch3D<T>::getComponentsOfBoxIndex(const size_t boxIndex)
+template <class T>
+template <class Visitor>
+void NeighboursSearch3D<T>::forEachNearbyBox(size_t boxIndex, Visitor&& visit) const
 {
-    size_t boxWidth = boxIndex % normalizedCuboidWidth;
-    size_t boxHeight = (boxIndex - boxWidth) / (normalizedCuboidWidth * normalizedCuboidLength);
-    size_t boxLength = (boxIndex - boxWidth -
-                        boxHeight * normalizedCuboidWidth * normalizedCuboidLength) / normalizedCuboidWidth;
+    size_t components[3];
+    getComponentsOfBoxIndex(boxIndex, components);
 
-    SizetVector components = {boxWidth, boxLength, boxHeight};
+    bool isInner = true;
 
-    return components;
-}
+    for (size_t axis = 0u; axis < 3u; ++axis)
+        isInner = isInner && components[axis] > 0u && components[axis] + 1u < m_axisBoxesNumber[axis];
 
-/**
- * @brief This method returns type of box (one of six), using its components (width, length and height).
- */
-
-template <class T> typename NeighboursSearch3D<T>::BoxType NeighboursSearch3D<T>::getBoxType(const SizetVector& components)
-{
-    if ((components[0] == 0 || components[0] == normalizedCuboidWidth - 1) &&
-        (components[1] == 0 || components[1] == normalizedCuboidLength - 1) &&
-        (components[2] == 0 || components[2] == normalizedCuboidHeight - 1))
+    if (isInner)
     {
-        return outerCorner;
-    }
+        for (const ptrdiff_t offset : m_stencilOffsets)
+            visit(static_cast<size_t>(static_cast<ptrdiff_t>(boxIndex) + offset));
 
-    if ((components[0] != 0 && components[0] != normalizedCuboidWidth - 1) &&
-        (components[1] == 0 || components[1] == normalizedCuboidLength - 1) &&
-        (components[2] != 0 && components[2] != normalizedCuboidHeight - 1))
-    {
-        return outerCenter;
+        return;
     }
 
-    if ((components[1] == 0 || components[1] == normalizedCuboidLength - 1) &&
-        (
-         ((components[0] != 0 && components[0] != normalizedCuboidWidth - 1) &&
-          (components[2] == 0 || components[2] == normalizedCuboidHeight - 1)) ||
-         ((components[0] == 0 || components[0] == normalizedCuboidWidth - 1) &&
-          (components[2] != 0 && components[2] != normalizedCuboidHeight - 1))
-         )
-        )
-    {
-        return outerLongitual;
-    }
+    // the components of the nearby boxes along every axis
+    size_t axisComponents[3][3];
+    size_t axisComponentsNumber[3];
 
-    if ((components[0] == 0 || components[0] == normalizedCuboidWidth - 1) &&
-        (components[1] != 0 && components[1] != normalizedCuboidLength - 1) &&
-        (components[2] == 0 || components[2] == normalizedCuboidHeight - 1))
+    for (size_t axis = 0u; axis < 3u; ++axis)
     {
-        return innerCorner;
-    }
+        const size_t boxesNumber = m_axisBoxesNumber[axis];
+        size_t& componentsNumber = axisComponentsNumber[axis];
 
-    if ((components[0] != 0 && components[0] != normalizedCuboidWidth - 1) &&
-        (components[1] != 0 && components[1] != normalizedCuboidLength - 1) &&
-        (components[2] != 0 && components[2] != normalizedCuboidHeight - 1))
-    {
-        return innerCenter;
-    }
+        componentsNumber = 0u;
 
-    if ((components[1] != 0 && components[1] != normalizedCuboidLength - 1) &&
-        (
-         ((components[0] != 0 && components[0] != normalizedCuboidWidth - 1) &&
-          (components[2] == 0 || components[2] == normalizedCuboidHeight - 1)) ||
-         ((components[0] == 0 || components[0] == normalizedCuboidWidth - 1) &&
-          (components[2] != 0 && components[2] != normalizedCuboidHeight - 1))
-         )
-        )
-    {
-        return innerLongitual;
+        if (m_periodicity.isPeriodic(axis) && boxesNumber >= 3u)
+        {
+            axisComponents[axis][componentsNumber++] = (components[axis] + boxesNumber - 1u) % boxesNumber;
+            axisComponents[axis][componentsNumber++] = components[axis];
+            axisComponents[axis][componentsNumber++] = (components[axis] + 1u) % boxesNumber;
+        }
+        else if (m_periodicity.isPeriodic(axis))
+        {
+            for (size_t component = 0u; component < boxesNumber; component++)
+                axisComponents[axis][componentsNumber++] = component;
+        }
+        else
+        {
+            const size_t first = components[axis] > 0u ? components[axis] - 1u : 0u;
+            const size_t last = std::min(components[axis] + 1u, boxesNumber - 1u);
+
+            for (size_t component = first; component <= last; component++)
+                axisComponents[axis][componentsNumber++] = component;
+        }
     }
 
-	return innerLongitual;
+    for (size_t height = 0u; height < axisComponentsNumber[2]; height++)
+        for (size_t length = 0u; length < axisComponentsNumber[1]; length++)
+            for (size_t width = 0u; width < axisComponentsNumber[0]; width++)
+            {
+                const size_t nearbyBoxIndex =
+                    axisComponents[0][width] +
+                    (axisComponents[1][length] + axisComponents[2][height] * m_axisBoxesNumber[1]) *
+                        m_axisBoxesNumber[0];
+
+                if (nearbyBoxIndex != boxIndex)
+                    visit(nearbyBoxIndex);
+            }
 }
 
-/**
- * @brief This method defines for box its neighbours, using box conmonents and type.
- */
+// ---------------------------
 
-template <class T> void NeighboursSearch3D<T>::defineNearbyBoxes(const NeighboursSearch3D<T>::BoxType boxType,
-                                                                 const SizetVector& components,
-                                                                 const size_t boxIndex)
+template <class T>
+MultiLevelNeighboursSearch3D<T>::MultiLevelNeighboursSearch3D(const Volume& volume,
+                                                              const std::vector<double>& levelRadii)
+    : m_origin(volume.getBoundingCuboid().startingPoint)
+    , m_levelRadii(levelRadii)
 {
-    bool isLeft     = components[0] == 0;
-    bool isRight    = components[0] == normalizedCuboidWidth - 1;
-    bool isBack     = components[1] == 0;
-//  bool isFront    = components[1] == normalizedCuboidLength - 1; // commented as not used
-    bool isBottom   = components[2] == 0;
-    bool isTop      = components[2] == normalizedCuboidHeight - 1;
-
-    switch (boxType) {
-        case outerCorner:
-            addNearbyBoxesFor(isLeft, isRight, isTop, isBottom, components, boxIndex);
-            isBack ? addForBack(boxIndex) : addForFront(boxIndex);
+    assert(!m_levelRadii.empty());
 
-            break;
+    std::sort(m_levelRadii.begin(), m_levelRadii.end());
 
-        case outerCenter:
-            addForCenter(components, boxIndex);
-            isBack ? addForBack(boxIndex) : addForFront(boxIndex);
-
-            break;
+    m_levelSupportRadii.resize(m_levelRadii.size());
+    m_levelBoxes.resize(m_levelRadii.size());
+}
 
-        case outerLongitual:
-            addNearbyBoxesFor(isLeft, isRight, isTop, isBottom, components, boxIndex);
-            isBack ? addForBack(boxIndex) : addForFront(boxIndex);
+template <class T> size_t MultiLevelNeighboursSearch3D<T>::getLevelsNumber() const
+{
+    return m_levelRadii.size();
+}
 
-            break;
+template <class T> size_t MultiLevelNeighboursSearch3D<T>::getLevel(double supportRadius) const
+{
+    const auto level = std::lower_bound(m_levelRadii.begin(), m_levelRadii.end(), supportRadius);
 
-        case innerCorner:
-            addNearbyBoxesFor(isLeft, isRight, isTop, isBottom, components, boxIndex);
-            addForMiddle(boxIndex);
+    return level == m_levelRadii.end() ? m_levelRadii.size() - 1u
+                                       : static_cast<size_t>(level - m_levelRadii.begin());
+}
 
-            break;
+/**
+ * @brief The boxes of the level within h_ij of the point are found by the largest support radius of the level.
+ * The range is one box around the point's box, while its support radius does not exceed the box size,
+ * and grows for the large points searching the fine levels.
+ */
+template <class T> void MultiLevelNeighboursSearch3D<T>::search(T& points)
+{
+    insertPointsIntoLevels(points);
 
-        case innerCenter:
-            addForCenter(components, boxIndex);
-            addForMiddle(boxIndex);
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        points[i].neighbours.clear();
 
-            break;
+        for (size_t level = 0u; level < m_levelRadii.size(); level++)
+        {
+            if (m_levelBoxes[level].empty())
+                continue;
 
-        case innerLongitual:
-            addNearbyBoxesFor(isLeft, isRight, isTop, isBottom, components, boxIndex);
-            addForMiddle(boxIndex);
+            const double searchRadius = 0.5 * (points[i].supportRadius + m_levelSupportRadii[level]);
+            const int64_t range = std::max<int64_t>(
+                1, static_cast<int64_t>(std::ceil(searchRadius / m_levelRadii[level])));
 
-            break;
-    }
-}
+            int64_t components[3];
+            getBoxComponents(points[i].position, m_levelRadii[level], components);
 
-template <class T> void NeighboursSearch3D<T>:: addNearbyBoxesFor(const bool isLeft,
-                                                                  const bool isRight,
-                                                                  const bool isTop,
-                                                                  const bool isBottom,
-                                                                  const SizetVector& components,
-                                                                  const size_t boxIndex)
-{
-    if (isLeft && isBottom) {
-        addForBottomLeft(components, boxIndex);
-        return;
-    }
+            for (int64_t dZ = -range; dZ <= range; dZ++)
+                for (int64_t dY = -range; dY <= range; dY++)
+                    for (int64_t dX = -range; dX <= range; dX++)
+                    {
+                        const int64_t nearbyComponents[3] = {components[0] + dX, components[1] + dY,
+                                                             components[2] + dZ};
 
-    if (isRight && isBottom) {
-        addForBottomRight(components, boxIndex);
-        return;
-    }
+                        const auto box = m_levelBoxes[level].find(packBoxKey(nearbyComponents));
 
-    if (isLeft && isTop) {
-        addForTopLeft(components, boxIndex);
-        return;
-    }
+                        if (box == m_levelBoxes[level].end())
+                            continue;
 
-    if (isRight && isTop) {
-        addForTopRight(components, boxIndex);
-        return;
-    }
+                        for (const size_t j : box->second)
+                        {
+                            if (j == i)
+                                continue;
 
-    if (isLeft) {
-        addForLeft(components, boxIndex);
-        return;
-    }
+                            const double supportRadius = 0.5 * (points[i].supportRadius + points[j].supportRadius);
+                            const auto difference = points[i].position - points[j].position;
 
-    if (isRight) {
-        addForRight(components, boxIndex);
-        return;
+                            if (difference.calcNormSqr() - supportRadius * supportRadius <= DBL_EPSILON)
+                                points[i].neighbours.push_back(j);
+                        }
+                    }
+        }
     }
+}
 
-    if (isBottom) {
-        addForBottom(components, boxIndex);
-        return;
+template <class T> void MultiLevelNeighboursSearch3D<T>::insertPointsIntoLevels(const T& points)
+{
+    for (size_t level = 0u; level < m_levelRadii.size(); level++)
+    {
+        m_levelBoxes[level].clear();
+        m_levelSupportRadii[level] = 0.;
     }
 
-    if (isTop) {
-        addForTop(components, boxIndex);
-        return;
-    }
-}
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        const size_t level = getLevel(points[i].supportRadius);
 
-template <class T> void NeighboursSearch3D<T>:: addForTopLeft(const SizetVector& /*components*/,
-                                                              const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addBotom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottomRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength + 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForTopRight(const SizetVector& /*components*/,
-                                                               const size_t boxIndex)
-{
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addBotom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottomLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForBottomLeft(const SizetVector& /*components*/,
-                                                                 const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength + 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForBottomRight(const SizetVector& /*components*/,
-                                                                  const size_t boxIndex)
-{
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForCenter(const SizetVector& /*components*/,
-                                                             const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength + 1);
-    // addTopLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength - 1);
-    // addBottomRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength + 1);
-    // addBottomLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForLeft(const SizetVector& /*components*/,
-                                                           const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength + 1);
-    // addBottomRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength + 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForRight(const SizetVector& /*components*/,
-                                                            const size_t boxIndex)
-{
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength - 1);
-    // addBottomLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForTop(const SizetVector& /*components*/,
-                                                          const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addBottom
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength);
-    // addBottomRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength + 1);
-    // addBottomLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForBottom(const SizetVector& /*components*/,
-                                                             const size_t boxIndex)
-{
-    // addRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + 1);
-    // addLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex - 1);
-    // addTop
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength);
-    // addTopRight
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength + 1);
-    // addTopLeft
-    m_nearbyBoxes[boxIndex].push_back(boxIndex + normalizedCuboidWidth * normalizedCuboidLength - 1);
-}
-
-template <class T> void NeighboursSearch3D<T>:: addForBack(const size_t boxIndex)
-{
-    SizetVector nearbyBoxes = m_nearbyBoxes[boxIndex];
-    nearbyBoxes.push_back(boxIndex);
-
-    for (size_t i = 0u; i < nearbyBoxes.size(); i++) {
-        nearbyBoxes[i] += normalizedCuboidWidth;
-        m_nearbyBoxes[boxIndex].push_back(nearbyBoxes[i]);
-    }
-}
+        m_levelSupportRadii[level] = std::max(m_levelSupportRadii[level], points[i].supportRadius);
 
-template <class T> void NeighboursSearch3D<T>:: addForFront(const size_t boxIndex)
-{
-    SizetVector nearbyBoxes = m_nearbyBoxes[boxIndex];
-    nearbyBoxes.push_back(boxIndex);
+        int64_t components[3];
+        getBoxComponents(points[i].position, m_levelRadii[level], components);
 
-    for (size_t i = 0u; i < nearbyBoxes.size(); i++) {
-        nearbyBoxes[i] -= normalizedCuboidWidth;
-        m_nearbyBoxes[boxIndex].push_back(nearbyBoxes[i]);
+        m_levelBoxes[level][packBoxKey(components)].push_back(i);
     }
 }
 
-template <class T> void NeighboursSearch3D<T>:: addForMiddle(const size_t boxIndex)
+template <class T>
+template <class Position>
+void MultiLevelNeighboursSearch3D<T>::getBoxComponents(const Position& position,
+                                                       double boxSize,
+                                                       int64_t components[3]) const
 {
-    // TODO: Debug
-    SizetVector nearbyBoxes = m_nearbyBoxes[boxIndex];
-    nearbyBoxes.push_back(boxIndex);
+    const double coordinates[3] = {position.x - m_origin.x, position.y - m_origin.y, position.z - m_origin.z};
 
-    addForBack(boxIndex);
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        const double component = std::floor(coordinates[axis] / boxSize);
 
-    for (size_t i = 0u; i < nearbyBoxes.size(); i++) {
-        nearbyBoxes[i] -= normalizedCuboidWidth;
-        m_nearbyBoxes[boxIndex].push_back(nearbyBoxes[i]);
+        components[axis] = static_cast<int64_t>(std::min(std::max(component, static_cast<double>(2 - HashedBoxBias)),
+                                                          static_cast<double>(HashedBoxBias - 2)));
     }
 }
 
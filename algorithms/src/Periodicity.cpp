@@ -0,0 +1,36 @@
+/**
+ * @file Periodicity.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Periodicity.h"
+
+namespace SPHAlgorithms
+{
+
+Periodicity::Periodicity()
+    : m_start()
+    , m_periods{0., 0., 0.}
+    , m_hasPeriodicAxes(false)
+{
+}
+
+Periodicity::Periodicity(const Cuboid& cuboid, bool periodicX, bool periodicY, bool periodicZ)
+    : m_start(cuboid.startingPoint)
+    , m_periods{periodicX ? cuboid.width : 0., periodicY ? cuboid.length : 0., periodicZ ? cuboid.height : 0.}
+    , m_hasPeriodicAxes(periodicX || periodicY || periodicZ)
+{
+}
+
+bool Periodicity::isPeriodic(size_t axis) const
+{
+    return m_periods[axis] > 0.;
+}
+
+bool Periodicity::hasPeriodicAxes() const
+{
+    return m_hasPeriodicAxes;
+}
+
+} // namespace SPHAlgorithms
@@ -0,0 +1,94 @@
+/**
+ * @file Periodicity.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef PERIODICITY_H_1A7E4C9B2D5F4E6A8C3B0D7F9E2A5C48
+#define PERIODICITY_H_1A7E4C9B2D5F4E6A8C3B0D7F9E2A5C48
+
+#include "Area.h"
+#include "Point.h"
+
+#include <cmath>
+#include <cstddef>
+
+namespace SPHAlgorithms
+{
+
+/**
+ * @brief Periodicity class defines the periodic axes of the cuboid: the point leaving the cuboid through the face
+ * of the periodic axis enters it through the opposite face, and the pairs of the points interact across the faces
+ * by their nearest images. The periodic axis is required to be two search radii long at least, so the pair has
+ * one image within the radius.
+ */
+class Periodicity
+{
+public:
+    /**
+     * @brief Creates the periodicity without the periodic axes.
+     */
+    Periodicity();
+
+    Periodicity(const Cuboid& cuboid, bool periodicX, bool periodicY, bool periodicZ);
+
+    bool isPeriodic(size_t axis) const;
+
+    bool hasPeriodicAxes() const;
+
+    /**
+     * @brief Returns the difference of the positions of the nearest images, its components along the periodic axes
+     * are within half of the cuboid.
+     */
+    template <class Scalar> Point3<Scalar> calcMinimumImage(const Point3<Scalar>& difference) const;
+
+    /**
+     * @brief Moves the position into the cuboid along the periodic axes.
+     */
+    template <class Scalar> Point3<Scalar> wrap(const Point3<Scalar>& position) const;
+
+private:
+    Point3D m_start;
+
+    double m_periods[3]; // the sizes of the cuboid along the periodic axes, 0 along the other ones
+
+    bool m_hasPeriodicAxes;
+};
+
+template <class Scalar> Point3<Scalar> Periodicity::calcMinimumImage(const Point3<Scalar>& difference) const
+{
+    if (!m_hasPeriodicAxes)
+        return difference;
+
+    Scalar components[3] = {difference.x, difference.y, difference.z};
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        if (m_periods[axis] > 0.)
+            components[axis] -= static_cast<Scalar>(m_periods[axis] * std::round(components[axis] / m_periods[axis]));
+    }
+
+    return Point3<Scalar>(components[0], components[1], components[2]);
+}
+
+template <class Scalar> Point3<Scalar> Periodicity::wrap(const Point3<Scalar>& position) const
+{
+    if (!m_hasPeriodicAxes)
+        return position;
+
+    const double starts[3] = {m_start.x, m_start.y, m_start.z};
+    Scalar components[3] = {position.x, position.y, position.z};
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        if (m_periods[axis] > 0.)
+            components[axis] -= static_cast<Scalar>(
+                m_periods[axis] * std::floor((components[axis] - starts[axis]) / m_periods[axis]));
+    }
+
+    return Point3<Scalar>(components[0], components[1], components[2]);
+}
+
+} // namespace SPHAlgorithms
+
+#endif // PERIODICITY_H_1A7E4C9B2D5F4E6A8C3B0D7F9E2A5C48
@@ -156,7 +156,8 @@ template <typename _Tp> inline bool operator!=(const Point3<_Tp>& a, const Point
     return a.x != b.x || a.y != b.y || a.z != b.z;
 }
 
-template <typename _Tp> inline Point3<_Tp> operator*=(Point3<_Tp>& a, const double b)
+// the scalar is converted to the coordinate type, so the float points are scaled in single precision
+template <typename _Tp> inline Point3<_Tp> operator*=(Point3<_Tp>& a, const typename Point3<_Tp>::value_type b)
 {
     a.x *= b;
     a.y *= b;
@@ -189,25 +190,30 @@ template <typename _Tp> inline Point3<_Tp> operator-(const Point3<_Tp>& a)
     return Point3<_Tp>(-a.x, -a.y, -a.z);
 }
 
-template <typename _Tp> inline Point3<_Tp> operator/(const Point3<_Tp> a, const double b)
+template <typename _Tp> inline Point3<_Tp> operator/(const Point3<_Tp> a, const typename Point3<_Tp>::value_type b)
 {
     return Point3<_Tp>(a.x / b, a.y / b, a.z / b);
 }
 
-template <typename _Tp> inline Point3<_Tp> operator/(const double b, const Point3<_Tp> a)
+template <typename _Tp> inline Point3<_Tp> operator/(const typename Point3<_Tp>::value_type b, const Point3<_Tp> a)
 {
     return Point3<_Tp>(b / a.x, b / a.y, b / a.z);
 }
 
-template <typename _Tp> inline Point3<_Tp> operator*(const Point3<_Tp>& a, const double b)
+template <typename _Tp> inline Point3<_Tp> operator*(const Point3<_Tp>& a, const typename Point3<_Tp>::value_type b)
 {
     return Point3<_Tp>(a.x * b, a.y * b, a.z * b);
 }
 
-template <typename _Tp> inline Point3<_Tp> operator*(const double b, const Point3<_Tp>& a)
+template <typename _Tp> inline Point3<_Tp> operator*(const typename Point3<_Tp>::value_type b, const Point3<_Tp>& a)
 {
     return Point3<_Tp>(b * a.x, b * a.y, b * a.z);
 }
+
+template <typename _Tp> inline _Tp calcDotProduct(const Point3<_Tp>& a, const Point3<_Tp>& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
 } // namespace SPHAlgorithms
 
 #endif // POINT_HPP_FCE0209B335F4EBB846046447678D096
@@ -31,6 +31,13 @@ public:
      * @return the result of disjunction R-operation in R0 system
      */
     template <class T> static T disjunction(T x, T y);
+
+    /**
+     * @brief Returns negation of x
+     * @param x    The x Cartesian coordinate
+     * @return the result of negation R-operation in R0 system
+     */
+    template <class T> static T negation(T x);
 };
 
 } // namespace SPHAlgorithms
@@ -20,4 +20,9 @@ template <class T> T ROperations::disjunction(T x, T y)
     return x + y + std::sqrt(x * x + y * y);
 }
 
+template <class T> T ROperations::negation(T x)
+{
+    return -x;
+}
+
 } // namespace SPHAlgorithms
@@ -0,0 +1,142 @@
+/**
+ * @file RigidTransform.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "RigidTransform.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace SPHAlgorithms
+{
+
+RigidTransform::RigidTransform()
+    : m_rotation{1., 0., 0., 0., 1., 0., 0., 0., 1.}
+{
+}
+
+RigidTransform::RigidTransform(const Point3D& translation)
+    : RigidTransform()
+{
+    m_translation = translation;
+}
+
+RigidTransform RigidTransform::fromAxisAngle(const Point3D& axis, double angle, const Point3D& translation)
+{
+    RigidTransform transform(translation);
+
+    const double norm = axis.calcNorm();
+
+    if (norm < DBL_EPSILON)
+        return transform;
+
+    const double ux = axis.x / norm;
+    const double uy = axis.y / norm;
+    const double uz = axis.z / norm;
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    const double t = 1. - c;
+
+    // Rodrigues' rotation formula
+    const double rotation[9] = {t * ux * ux + c,      t * ux * uy - s * uz, t * ux * uz + s * uy,
+                                t * ux * uy + s * uz, t * uy * uy + c,      t * uy * uz - s * ux,
+                                t * ux * uz - s * uy, t * uy * uz + s * ux, t * uz * uz + c};
+
+    std::copy(rotation, rotation + 9, transform.m_rotation);
+
+    return transform;
+}
+
+Point3D RigidTransform::toWorld(const Point3D& point) const
+{
+    return rotate(point) + m_translation;
+}
+
+Point3D RigidTransform::toLocal(const Point3D& point) const
+{
+    return inverseRotate(point - m_translation);
+}
+
+Point3D RigidTransform::rotate(const Point3D& direction) const
+{
+    return Point3D(m_rotation[0] * direction.x + m_rotation[1] * direction.y + m_rotation[2] * direction.z,
+                   m_rotation[3] * direction.x + m_rotation[4] * direction.y + m_rotation[5] * direction.z,
+                   m_rotation[6] * direction.x + m_rotation[7] * direction.y + m_rotation[8] * direction.z);
+}
+
+Point3D RigidTransform::inverseRotate(const Point3D& direction) const
+{
+    // the inverse rotation is the transposed matrix
+    return Point3D(m_rotation[0] * direction.x + m_rotation[3] * direction.y + m_rotation[6] * direction.z,
+                   m_rotation[1] * direction.x + m_rotation[4] * direction.y + m_rotation[7] * direction.z,
+                   m_rotation[2] * direction.x + m_rotation[5] * direction.y + m_rotation[8] * direction.z);
+}
+
+// Returns the bounds of the mapped corners of the cuboid
+template <class Mapping> static Cuboid mapCuboid(const Cuboid& cuboid, Mapping mapping)
+{
+    Point3D start = mapping(cuboid.startingPoint);
+    Point3D end = start;
+
+    for (int corner = 1; corner < 8; ++corner)
+    {
+        const Point3D point = mapping(cuboid.startingPoint + Point3D(corner & 1 ? cuboid.width : 0.,
+                                                                     corner & 2 ? cuboid.length : 0.,
+                                                                     corner & 4 ? cuboid.height : 0.));
+
+        start = Point3D(std::min(start.x, point.x), std::min(start.y, point.y), std::min(start.z, point.z));
+        end = Point3D(std::max(end.x, point.x), std::max(end.y, point.y), std::max(end.z, point.z));
+    }
+
+    return Cuboid(start, end.x - start.x, end.y - start.y, end.z - start.z);
+}
+
+Cuboid RigidTransform::toWorld(const Cuboid& cuboid) const
+{
+    return mapCuboid(cuboid, [this](const Point3D& point) { return toWorld(point); });
+}
+
+Cuboid RigidTransform::toLocal(const Cuboid& cuboid) const
+{
+    return mapCuboid(cuboid, [this](const Point3D& point) { return toLocal(point); });
+}
+
+RigidTransform RigidTransform::operator*(const RigidTransform& other) const
+{
+    RigidTransform result(toWorld(other.m_translation));
+
+    for (int row = 0; row < 3; ++row)
+        for (int column = 0; column < 3; ++column)
+            result.m_rotation[3 * row + column] = m_rotation[3 * row] * other.m_rotation[column] +
+                                                  m_rotation[3 * row + 1] * other.m_rotation[3 + column] +
+                                                  m_rotation[3 * row + 2] * other.m_rotation[6 + column];
+
+    return result;
+}
+
+Point3D RigidTransform::getTranslation() const
+{
+    return m_translation;
+}
+
+void RigidTransform::getMatrix(double matrix[16]) const
+{
+    for (size_t column = 0u; column < 3u; ++column)
+    {
+        for (size_t row = 0u; row < 3u; ++row)
+        {
+            matrix[column * 4u + row] = m_rotation[row * 3u + column];
+        }
+        matrix[column * 4u + 3u] = 0.;
+    }
+
+    matrix[12] = m_translation.x;
+    matrix[13] = m_translation.y;
+    matrix[14] = m_translation.z;
+    matrix[15] = 1.;
+}
+
+} // namespace SPHAlgorithms
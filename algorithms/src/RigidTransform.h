@@ -0,0 +1,82 @@
+/**
+ * @file RigidTransform.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef RIGID_TRANSFORM_H_8C1E5B3A7D2F4A9E6B0C4D8F1A3E5C79
+#define RIGID_TRANSFORM_H_8C1E5B3A7D2F4A9E6B0C4D8F1A3E5C79
+
+#include "Area.h"
+#include "Point.h"
+
+namespace SPHAlgorithms
+{
+
+/**
+ * @brief RigidTransform class defines the rotation followed by the translation, which maps the local space
+ * of a body into the world space: world = rotation * local + translation.
+ */
+class RigidTransform
+{
+public:
+    /**
+     * @brief Creates the identity transform.
+     */
+    RigidTransform();
+
+    explicit RigidTransform(const Point3D& translation);
+
+    /**
+     * @brief Creates the rotation around the axis through the local origin followed by the translation.
+     * @param axis           The rotation axis, it is not required to be normalized
+     * @param angle          The rotation angle in radians
+     * @param translation    The position of the local origin in the world space
+     */
+    static RigidTransform fromAxisAngle(const Point3D& axis, double angle, const Point3D& translation = Point3D());
+
+    Point3D toWorld(const Point3D& point) const;
+
+    Point3D toLocal(const Point3D& point) const;
+
+    /**
+     * @brief Rotates the direction from the local space into the world space.
+     */
+    Point3D rotate(const Point3D& direction) const;
+
+    /**
+     * @brief Rotates the direction from the world space into the local space.
+     */
+    Point3D inverseRotate(const Point3D& direction) const;
+
+    /**
+     * @brief Returns the axis-aligned cuboid which contains the local cuboid placed into the world space.
+     */
+    Cuboid toWorld(const Cuboid& cuboid) const;
+
+    /**
+     * @brief Returns the axis-aligned cuboid which contains the world cuboid placed into the local space.
+     */
+    Cuboid toLocal(const Cuboid& cuboid) const;
+
+    /**
+     * @brief Returns the transform which applies the other transform first and then this one.
+     */
+    RigidTransform operator*(const RigidTransform& other) const;
+
+    Point3D getTranslation() const;
+
+    /**
+     * @brief Writes the homogeneous 4x4 matrix of the transform stored by columns, as OpenGL expects it.
+     */
+    void getMatrix(double matrix[16]) const;
+
+private:
+    double m_rotation[9]; // the rotation matrix stored by rows
+
+    Point3D m_translation;
+};
+
+} // namespace SPHAlgorithms
+
+#endif // RIGID_TRANSFORM_H_8C1E5B3A7D2F4A9E6B0C4D8F1A3E5C79
@@ -0,0 +1,497 @@
+/**
+ * @file ShapeExpressions.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef SHAPE_EXPRESSIONS_H_7D3B1F5E2A9C4B6D8E0F1A3C5B7D9E2F
+#define SHAPE_EXPRESSIONS_H_7D3B1F5E2A9C4B6D8E0F1A3C5B7D9E2F
+
+#include "Area.h"
+#include "Point.h"
+#include "ROperations.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPHAlgorithms
+{
+
+/**
+ * @brief ShapeExpressions namespace contains expression templates which compose shapes equations using
+ * the R-functions method. Every expression is a concrete functor type, so the whole shape is inlined into
+ * the code which takes it as a template parameter.
+ * All the expressions return a value that > 0 inside the object, = 0 on the border and < 0 outside.
+ * Every expression also reports an axis-aligned cuboid which contains all the points where it is > 0.
+ */
+namespace ShapeExpressions
+{
+
+// The half size of the bounds of the shapes which are not limited along some axis
+constexpr double UnboundedExtent = 1e9;
+
+inline Cuboid unboundedCuboid()
+{
+    return Cuboid(Point3D(-UnboundedExtent, -UnboundedExtent, -UnboundedExtent), 2. * UnboundedExtent,
+                  2. * UnboundedExtent, 2. * UnboundedExtent);
+}
+
+/**
+ * @brief ShapeExpression is the base of all the expressions, it lets the R-operators accept only shapes.
+ */
+template <class Derived> struct ShapeExpression
+{
+    constexpr const Derived& derived() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+// ---------------------------
+// Primitives
+
+/**
+ * @brief Sphere with the center and the radius.
+ */
+struct Sphere : ShapeExpression<Sphere>
+{
+    Sphere(const Point3F& _center, float _radius)
+        : center(_center)
+        , radius(_radius)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        const T dx = x - T(center.x);
+        const T dy = y - T(center.y);
+        const T dz = z - T(center.z);
+
+        return T(radius * radius) - dx * dx - dy * dy - dz * dz;
+    }
+
+    Cuboid bounds() const
+    {
+        return Cuboid(Point3D(center.x - radius, center.y - radius, center.z - radius), 2. * radius, 2. * radius,
+                      2. * radius);
+    }
+
+    Point3F center;
+    float   radius;
+};
+
+/**
+ * @brief Cylinder along z axis with the center of its base, the radius and the height.
+ */
+struct Cylinder : ShapeExpression<Cylinder>
+{
+    Cylinder(const Point3F& _center, float _radius, float _height)
+        : center(_center)
+        , radius(_radius)
+        , height(_height)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        const T dx = x - T(center.x);
+        const T dy = y - T(center.y);
+        const T dz = z - T(center.z);
+
+        return ROperations::conjunction<T>(T(radius * radius) - dx * dx - dy * dy, dz * (T(height) - dz));
+    }
+
+    Cuboid bounds() const
+    {
+        return Cuboid(Point3D(center.x - radius, center.y - radius, center.z), 2. * radius, 2. * radius, height);
+    }
+
+    Point3F center;
+    float   radius;
+    float   height;
+};
+
+/**
+ * @brief Box with the minimal corner and the sizes along x, y and z axis.
+ */
+struct Box : ShapeExpression<Box>
+{
+    Box(const Point3F& _corner, float _width, float _length, float _height)
+        : corner(_corner)
+        , width(_width)
+        , length(_length)
+        , height(_height)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        const T dx = x - T(corner.x);
+        const T dy = y - T(corner.y);
+        const T dz = z - T(corner.z);
+
+        return ROperations::conjunction<T>(
+            ROperations::conjunction<T>(dx * (T(width) - dx), dy * (T(length) - dy)), dz * (T(height) - dz));
+    }
+
+    Cuboid bounds() const
+    {
+        return Cuboid(Point3D(corner.x, corner.y, corner.z), width, length, height);
+    }
+
+    Point3F corner;
+    float   width;
+    float   length;
+    float   height;
+};
+
+/**
+ * @brief Half-space {p : normal * p <= offset}, the normal points outside.
+ */
+struct HalfSpace : ShapeExpression<HalfSpace>
+{
+    HalfSpace(const Point3F& _normal, float _offset)
+        : normal(_normal)
+        , offset(_offset)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return T(offset) - T(normal.x) * x - T(normal.y) * y - T(normal.z) * z;
+    }
+
+    /**
+     * @brief The half-space is limited only when its normal is parallel to one of the axes.
+     */
+    Cuboid bounds() const
+    {
+        const float components[3] = {normal.x, normal.y, normal.z};
+
+        double start[3] = {-UnboundedExtent, -UnboundedExtent, -UnboundedExtent};
+        double end[3] = {UnboundedExtent, UnboundedExtent, UnboundedExtent};
+
+        const int nonZero = (components[0] != 0.f) + (components[1] != 0.f) + (components[2] != 0.f);
+
+        for (int axis = 0; nonZero == 1 && axis < 3; ++axis)
+        {
+            if (components[axis] > 0.f)
+                end[axis] = offset / components[axis];
+            else if (components[axis] < 0.f)
+                start[axis] = offset / components[axis];
+        }
+
+        return Cuboid(Point3D(start[0], start[1], start[2]), end[0] - start[0], end[1] - start[1], end[2] - start[2]);
+    }
+
+    Point3F normal;
+    float   offset;
+};
+
+/**
+ * @brief Axis-aligned quadric a * dx^2 + b * dy^2 + c * dz^2 + d around the center.
+ * Covers ellipsoids, hyperboloids, cones and the slabs used by the chess shapes.
+ */
+struct Quadric : ShapeExpression<Quadric>
+{
+    Quadric(const Point3F& _center, float _a, float _b, float _c, float _d)
+        : center(_center)
+        , a(_a)
+        , b(_b)
+        , c(_c)
+        , d(_d)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        const T dx = x - T(center.x);
+        const T dy = y - T(center.y);
+        const T dz = z - T(center.z);
+
+        return T(a) * dx * dx + T(b) * dy * dy + T(c) * dz * dz + T(d);
+    }
+
+    /**
+     * @brief The quadric is limited along the axes with negative coefficients when none of them is positive,
+     * otherwise the positive term grows without limit and the shape is unbounded.
+     */
+    Cuboid bounds() const
+    {
+        const float coefficients[3] = {a, b, c};
+        const float centerComponents[3] = {center.x, center.y, center.z};
+
+        if (a > 0.f || b > 0.f || c > 0.f)
+            return unboundedCuboid();
+
+        // the shape is empty
+        if (d <= 0.f)
+            return Cuboid(Point3D(center.x, center.y, center.z), 0., 0., 0.);
+
+        double start[3];
+        double size[3];
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const double halfSize =
+                coefficients[axis] < 0.f ? std::sqrt(static_cast<double>(d) / -coefficients[axis]) : UnboundedExtent;
+
+            start[axis] = centerComponents[axis] - halfSize;
+            size[axis] = 2. * halfSize;
+        }
+
+        return Cuboid(Point3D(start[0], start[1], start[2]), size[0], size[1], size[2]);
+    }
+
+    Point3F center;
+    float   a, b, c, d;
+};
+
+// ---------------------------
+// R-operations
+
+/**
+ * @brief Intersection of two shapes.
+ */
+template <class L, class R> struct Conjunction : ShapeExpression<Conjunction<L, R>>
+{
+    Conjunction(const L& _left, const R& _right)
+        : left(_left)
+        , right(_right)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return ROperations::conjunction<T>(left(x, y, z), right(x, y, z));
+    }
+
+    Cuboid bounds() const
+    {
+        return intersectCuboids(left.bounds(), right.bounds());
+    }
+
+    L left;
+    R right;
+};
+
+/**
+ * @brief Union of two shapes.
+ */
+template <class L, class R> struct Disjunction : ShapeExpression<Disjunction<L, R>>
+{
+    Disjunction(const L& _left, const R& _right)
+        : left(_left)
+        , right(_right)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return ROperations::disjunction<T>(left(x, y, z), right(x, y, z));
+    }
+
+    Cuboid bounds() const
+    {
+        return uniteCuboids(left.bounds(), right.bounds());
+    }
+
+    L left;
+    R right;
+};
+
+/**
+ * @brief Complement of the shape.
+ */
+template <class E> struct Negation : ShapeExpression<Negation<E>>
+{
+    explicit Negation(const E& _expression)
+        : expression(_expression)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return ROperations::negation<T>(expression(x, y, z));
+    }
+
+    Cuboid bounds() const
+    {
+        return unboundedCuboid();
+    }
+
+    E expression;
+};
+
+// ---------------------------
+// Transforms
+
+/**
+ * @brief Shape moved by the offset.
+ */
+template <class E> struct Translation : ShapeExpression<Translation<E>>
+{
+    Translation(const E& _expression, const Point3F& _offset)
+        : expression(_expression)
+        , offset(_offset)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return expression(x - T(offset.x), y - T(offset.y), z - T(offset.z));
+    }
+
+    Cuboid bounds() const
+    {
+        Cuboid result = expression.bounds();
+        result.startingPoint += Point3D(offset.x, offset.y, offset.z);
+
+        return result;
+    }
+
+    E       expression;
+    Point3F offset;
+};
+
+/**
+ * @brief Shape scaled relative to the origin by the factor along each axis.
+ */
+template <class E> struct Scaling : ShapeExpression<Scaling<E>>
+{
+    Scaling(const E& _expression, const Point3F& _factor)
+        : expression(_expression)
+        , factor(_factor)
+    {
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        return expression(x / T(factor.x), y / T(factor.y), z / T(factor.z));
+    }
+
+    Cuboid bounds() const
+    {
+        const Cuboid  cuboid = expression.bounds();
+        const Point3D first(cuboid.startingPoint.x * factor.x, cuboid.startingPoint.y * factor.y,
+                            cuboid.startingPoint.z * factor.z);
+        const Point3D second((cuboid.startingPoint.x + cuboid.width) * factor.x,
+                             (cuboid.startingPoint.y + cuboid.length) * factor.y,
+                             (cuboid.startingPoint.z + cuboid.height) * factor.z);
+
+        // a negative factor mirrors the shape
+        return Cuboid(Point3D(std::min(first.x, second.x), std::min(first.y, second.y), std::min(first.z, second.z)),
+                      std::abs(second.x - first.x), std::abs(second.y - first.y), std::abs(second.z - first.z));
+    }
+
+    E       expression;
+    Point3F factor;
+};
+
+/**
+ * @brief Shape rotated around the axis through the origin, the matrix is stored by rows.
+ */
+template <class E> struct Rotation : ShapeExpression<Rotation<E>>
+{
+    Rotation(const E& _expression, const Point3F& axis, float angle)
+        : expression(_expression)
+    {
+        const float norm = axis.calcNorm();
+        const float ux = axis.x / norm;
+        const float uy = axis.y / norm;
+        const float uz = axis.z / norm;
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+        const float t = 1.f - c;
+
+        // Rodrigues' rotation formula
+        const float rotation[9] = {t * ux * ux + c,      t * ux * uy - s * uz, t * ux * uz + s * uy,
+                                   t * ux * uy + s * uz, t * uy * uy + c,      t * uy * uz - s * ux,
+                                   t * ux * uz - s * uy, t * uy * uz + s * ux, t * uz * uz + c};
+
+        for (int i = 0; i < 9; ++i)
+            matrix[i] = rotation[i];
+    }
+
+    template <class T> T operator()(T x, T y, T z) const
+    {
+        // the inverse rotation is the transposed matrix
+        return expression(T(matrix[0]) * x + T(matrix[3]) * y + T(matrix[6]) * z,
+                          T(matrix[1]) * x + T(matrix[4]) * y + T(matrix[7]) * z,
+                          T(matrix[2]) * x + T(matrix[5]) * y + T(matrix[8]) * z);
+    }
+
+    /**
+     * @brief Returns the bounds of the rotated corners of the expression bounds.
+     */
+    Cuboid bounds() const
+    {
+        const Cuboid cuboid = expression.bounds();
+        const double size[3] = {cuboid.width, cuboid.length, cuboid.height};
+
+        double start[3] = {UnboundedExtent, UnboundedExtent, UnboundedExtent};
+        double end[3] = {-UnboundedExtent, -UnboundedExtent, -UnboundedExtent};
+
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const double point[3] = {cuboid.startingPoint.x + (corner & 1 ? size[0] : 0.),
+                                     cuboid.startingPoint.y + (corner & 2 ? size[1] : 0.),
+                                     cuboid.startingPoint.z + (corner & 4 ? size[2] : 0.)};
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const double rotated =
+                    matrix[3 * axis] * point[0] + matrix[3 * axis + 1] * point[1] + matrix[3 * axis + 2] * point[2];
+
+                start[axis] = std::min(start[axis], rotated);
+                end[axis] = std::max(end[axis], rotated);
+            }
+        }
+
+        return Cuboid(Point3D(start[0], start[1], start[2]), end[0] - start[0], end[1] - start[1], end[2] - start[2]);
+    }
+
+    E     expression;
+    float matrix[9];
+};
+
+// ---------------------------
+// Operators and helpers
+
+template <class L, class R>
+Conjunction<L, R> operator&(const ShapeExpression<L>& left, const ShapeExpression<R>& right)
+{
+    return Conjunction<L, R>(left.derived(), right.derived());
+}
+
+template <class L, class R>
+Disjunction<L, R> operator|(const ShapeExpression<L>& left, const ShapeExpression<R>& right)
+{
+    return Disjunction<L, R>(left.derived(), right.derived());
+}
+
+template <class E> Negation<E> operator!(const ShapeExpression<E>& expression)
+{
+    return Negation<E>(expression.derived());
+}
+
+template <class E> Translation<E> translate(const ShapeExpression<E>& expression, const Point3F& offset)
+{
+    return Translation<E>(expression.derived(), offset);
+}
+
+template <class E> Scaling<E> scale(const ShapeExpression<E>& expression, const Point3F& factor)
+{
+    return Scaling<E>(expression.derived(), factor);
+}
+
+template <class E> Rotation<E> rotate(const ShapeExpression<E>& expression, const Point3F& axis, float angle)
+{
+    return Rotation<E>(expression.derived(), axis, angle);
+}
+
+} // namespace ShapeExpressions
+
+} // namespace SPHAlgorithms
+
+#endif // SHAPE_EXPRESSIONS_H_7D3B1F5E2A9C4B6D8E0F1A3C5B7D9E2F
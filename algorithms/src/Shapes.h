@@ -8,6 +8,7 @@
 #define SHAPES_H_19D5A367806A431C96F39D5F50B94D31
 
 #include "ROperations.h"
+#include "ShapeExpressions.h"
 
 namespace SPHAlgorithms
 {
@@ -59,6 +60,42 @@ public:
         return dis(con(con(0.25f - x_sqr - y_sqr, -20.f * (x_sqr + y_sqr) + 1.f + 10.f * z1_sqr), z * (1.25f - z)),
                    dis(0.2f - x_sqr - y_sqr - 20.f * z2_sqr, 0.2f - 5.f * x_sqr - 4.f * y_sqr - z3_sqr));
     }
+
+    /**
+     * @brief Represents the pawn as a composed shape expression, so it can be inlined by the code
+     * which takes the obstacle as a template parameter.
+     * @return the expression equal to Pawn.
+     */
+    static auto PawnExpression()
+    {
+        using namespace ShapeExpressions;
+
+        const Quadric body(Point3F(1.5f, 1.5f, 0.f), -1.f, -1.f, 0.f, 0.25f);
+        const Quadric waist(Point3F(1.5f, 1.5f, 0.75f), -20.f, -20.f, 10.f, 1.f);
+        const Quadric base(Point3F(0.f, 0.f, 0.5f), 0.f, 0.f, -1.f, 0.25f);
+        const Quadric collar(Point3F(1.5f, 1.5f, 1.f), -1.f, -1.f, -20.f, 0.125f);
+        const Quadric head(Point3F(1.5f, 1.5f, 1.25f), -1.f, -1.f, -1.f, 0.05f);
+
+        return (body & waist & base) | (collar | head);
+    }
+
+    /**
+     * @brief Represents the bishop as a composed shape expression, so it can be inlined by the code
+     * which takes the obstacle as a template parameter.
+     * @return the expression equal to Bishop.
+     */
+    static auto BishopExpression()
+    {
+        using namespace ShapeExpressions;
+
+        const Quadric body(Point3F(1.5f, 1.5f, 0.f), -1.f, -1.f, 0.f, 0.25f);
+        const Quadric waist(Point3F(1.5f, 1.5f, 0.85f), -20.f, -20.f, 10.f, 1.f);
+        const Quadric base(Point3F(0.f, 0.f, 0.625f), 0.f, 0.f, -1.f, 0.390625f);
+        const Quadric collar(Point3F(1.5f, 1.5f, 1.25f), -1.f, -1.f, -20.f, 0.2f);
+        const Quadric head(Point3F(1.5f, 1.5f, 1.4f), -5.f, -4.f, -1.f, 0.2f);
+
+        return (body & waist & base) | (collar | head);
+    }
 };
 
 } // namespace SPHAlgorithms
@@ -0,0 +1,82 @@
+/**
+ * @file DistanceFieldTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "DistanceFieldTestSuite.h"
+
+#include "DistanceField.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHAlgorithms
+{
+namespace TestEnvironment
+{
+
+// sphere with radius 0.5 in the center of the unit cube
+static float sphere(float x, float y, float z)
+{
+    return 0.25f - (x - 0.5f) * (x - 0.5f) - (y - 0.5f) * (y - 0.5f) - (z - 0.5f) * (z - 0.5f);
+}
+
+static const Cuboid UnitCube(Point3D(0., 0., 0.), 1., 1., 1.);
+
+void DistanceFieldTestSuite::sphereDistance()
+{
+    const DistanceField field(sphere, UnitCube, 0.02);
+
+    EXPECT_EQ(51u, field.m_nodesNumber[0]);
+    EXPECT_EQ(51u, field.m_nodesNumber[1]);
+    EXPECT_EQ(51u, field.m_nodesNumber[2]);
+
+    // the normalized value (r^2 - d^2) / 2d is close to r - d near the border
+    EXPECT_NEAR(0.f, field.value(Point3F(1.f, 0.5f, 0.5f)), 1e-3f);
+    EXPECT_NEAR(0.f, field.value(Point3F(0.5f, 0.5f, 0.f)), 1e-3f);
+    EXPECT_NEAR((0.25f - 0.45f * 0.45f) / 0.9f, field.value(Point3F(0.5f, 0.95f, 0.5f)), 1e-3f);
+    EXPECT_NEAR((0.25f - 0.32f) / (2.f * std::sqrt(0.32f)), field.value(Point3F(0.1f, 0.1f, 0.5f)), 1e-3f);
+}
+
+void DistanceFieldTestSuite::sphereGradient()
+{
+    const DistanceField field(sphere, UnitCube, 0.02);
+
+    const Point3F right = field.gradient(Point3F(0.93f, 0.5f, 0.5f));
+    EXPECT_NEAR(-1.f, right.x, 1e-3f);
+    EXPECT_NEAR(0.f, right.y, 1e-3f);
+    EXPECT_NEAR(0.f, right.z, 1e-3f);
+
+    const Point3F diagonal = field.gradient(Point3F(0.2f, 0.2f, 0.5f));
+    EXPECT_NEAR(1.f / std::sqrt(2.f), diagonal.x, 1e-3f);
+    EXPECT_NEAR(1.f / std::sqrt(2.f), diagonal.y, 1e-3f);
+    EXPECT_NEAR(0.f, diagonal.z, 1e-3f);
+}
+
+void DistanceFieldTestSuite::outsideOfGrid()
+{
+    const DistanceField field(sphere, UnitCube, 0.02);
+
+    EXPECT_NEAR(field.value(Point3F(1.f, 0.5f, 0.5f)) - 1.f, field.value(Point3F(2.f, 0.5f, 0.5f)), 1e-5f);
+    EXPECT_GT(0.f, field.value(Point3F(-1.f, -1.f, -1.f)));
+}
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+using namespace SPHAlgorithms::TestEnvironment;
+
+TEST(DistanceFieldTestSuite, sphereDistance)
+{
+    DistanceFieldTestSuite::sphereDistance();
+}
+
+TEST(DistanceFieldTestSuite, sphereGradient)
+{
+    DistanceFieldTestSuite::sphereGradient();
+}
+
+TEST(DistanceFieldTestSuite, outsideOfGrid)
+{
+    DistanceFieldTestSuite::outsideOfGrid();
+}
@@ -0,0 +1,29 @@
+/**
+ * @file DistanceFieldTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef DISTANCE_FIELD_TEST_SUITE_H_0B7E2A4C9D1F4E6A8B3C5D7E9F1A2B4C
+#define DISTANCE_FIELD_TEST_SUITE_H_0B7E2A4C9D1F4E6A8B3C5D7E9F1A2B4C
+
+namespace SPHAlgorithms
+{
+
+namespace TestEnvironment
+{
+
+class DistanceFieldTestSuite
+{
+public:
+    static void sphereDistance();
+
+    static void sphereGradient();
+
+    static void outsideOfGrid();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+#endif // DISTANCE_FIELD_TEST_SUITE_H_0B7E2A4C9D1F4E6A8B3C5D7E9F1A2B4C
@@ -0,0 +1,270 @@
+/**
+ * @file LinearSolversTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "LinearSolversTestSuite.h"
+
+#include "LinearSolvers.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHAlgorithms
+{
+namespace TestEnvironment
+{
+
+namespace
+{
+struct Node
+{
+    SizetVector neighbours;
+};
+
+const size_t NodesNumber = 50u;
+
+const double Tolerance = 1e-10;
+
+/**
+ * @brief Returns the matrix of the chain of the nodes, every node is the neighbour of the previous and the next
+ * ones, the coefficients are of the previous and the next nodes.
+ */
+NeighbourMatrix createChainMatrix(double diagonal, double previous, double next)
+{
+    std::vector<Node> nodes(NodesNumber);
+    for (size_t i = 0; i < NodesNumber; i++)
+    {
+        if (i > 0)
+            nodes[i].neighbours.push_back(i - 1u);
+        if (i + 1u < NodesNumber)
+            nodes[i].neighbours.push_back(i + 1u);
+    }
+
+    NeighbourMatrix matrix;
+    matrix.setPattern(nodes);
+
+    for (size_t i = 0; i < NodesNumber; i++)
+    {
+        matrix.setDiagonal(i, diagonal);
+
+        for (size_t pair = matrix.getPairsBegin(i); pair < matrix.getPairsEnd(i); pair++)
+            matrix.setCoefficient(pair, matrix.getColumn(pair) < i ? previous : next);
+    }
+
+    return matrix;
+}
+
+std::vector<double> createSolution()
+{
+    std::vector<double> solution(NodesNumber);
+    for (size_t i = 0; i < NodesNumber; i++)
+        solution[i] = std::sin(0.3 * i) + 0.01 * i;
+
+    return solution;
+}
+
+template <class Solver>
+void expectSolution(Solver& solver, const NeighbourMatrix& matrix, const std::vector<double>& solution)
+{
+    std::vector<double> rhs;
+    SPHAlgorithms::multiply(matrix, solution, rhs);
+
+    std::vector<double> x(NodesNumber, 0.);
+    const SolverStatistics& statistics = solver.solve(matrix, rhs, x);
+
+    EXPECT_TRUE(statistics.converged);
+    EXPECT_LT(0u, statistics.iterationsNumber);
+    EXPECT_GT(Tolerance, statistics.residual);
+
+    for (size_t i = 0; i < NodesNumber; i++)
+        EXPECT_NEAR(solution[i], x[i], 1e-8);
+}
+} // namespace
+
+void LinearSolversTestSuite::multiply()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2., -1., -0.5);
+
+    EXPECT_EQ(NodesNumber, matrix.getRowsNumber());
+
+    std::vector<double> x(NodesNumber, 0.);
+    x[0] = 1.;
+    x[1] = 2.;
+    x[2] = 3.;
+
+    std::vector<double> result;
+    SPHAlgorithms::multiply(matrix, x, result);
+
+    ASSERT_EQ(NodesNumber, result.size());
+    EXPECT_DOUBLE_EQ(2. - 0.5 * 2., result[0]);
+    EXPECT_DOUBLE_EQ(-1. + 2. * 2. - 0.5 * 3., result[1]);
+    EXPECT_DOUBLE_EQ(-1. * 2. + 2. * 3., result[2]);
+    EXPECT_DOUBLE_EQ(-3., result[3]);
+    EXPECT_DOUBLE_EQ(0., result[4]);
+}
+
+void LinearSolversTestSuite::dotProduct()
+{
+    const std::vector<Point3D> a = {Point3D(1., 2., 3.), Point3D(-1., 0., 0.5)};
+    const std::vector<Point3D> b = {Point3D(2., 0., 1.), Point3D(4., 7., 2.)};
+
+    EXPECT_DOUBLE_EQ(5. - 4. + 1., calcDotProduct(a, b));
+
+    std::vector<double> c(1000, 0.5);
+    EXPECT_DOUBLE_EQ(250., calcDotProduct(c, c));
+}
+
+void LinearSolversTestSuite::jacobi()
+{
+    JacobiSolver<double> solver(Tolerance, 1000u);
+    expectSolution(solver, createChainMatrix(2.5, -1., -1.), createSolution());
+}
+
+void LinearSolversTestSuite::gaussSeidel()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2.5, -1., -1.);
+
+    JacobiSolver<double> jacobiSolver(Tolerance, 1000u);
+    expectSolution(jacobiSolver, matrix, createSolution());
+
+    GaussSeidelSolver<double> solver(Tolerance, 1000u);
+    expectSolution(solver, matrix, createSolution());
+
+    EXPECT_GT(jacobiSolver.getStatistics().iterationsNumber, solver.getStatistics().iterationsNumber);
+}
+
+void LinearSolversTestSuite::conjugateGradient()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2.5, -1., -1.);
+
+    GaussSeidelSolver<double> gaussSeidelSolver(Tolerance, 1000u);
+    expectSolution(gaussSeidelSolver, matrix, createSolution());
+
+    ConjugateGradientSolver<double> solver(Tolerance, 1000u);
+    expectSolution(solver, matrix, createSolution());
+
+    EXPECT_GT(gaussSeidelSolver.getStatistics().iterationsNumber, solver.getStatistics().iterationsNumber);
+
+    // the warm start from the solution
+    std::vector<double> rhs;
+    SPHAlgorithms::multiply(matrix, createSolution(), rhs);
+
+    std::vector<double> x = createSolution();
+    solver.solve(matrix, rhs, x);
+
+    EXPECT_TRUE(solver.getStatistics().converged);
+    EXPECT_EQ(0u, solver.getStatistics().iterationsNumber);
+}
+
+void LinearSolversTestSuite::biConjugateGradientStabilized()
+{
+    BiConjugateGradientStabilizedSolver<double> solver(Tolerance, 1000u);
+    expectSolution(solver, createChainMatrix(2.5, -1.4, -0.6), createSolution());
+}
+
+void LinearSolversTestSuite::vectorValues()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2.5, -1., -1.);
+
+    std::vector<Point3D> solution(NodesNumber);
+    for (size_t i = 0; i < NodesNumber; i++)
+        solution[i] = Point3D(std::sin(0.3 * i), 1., -0.1 * i);
+
+    std::vector<Point3D> rhs;
+    SPHAlgorithms::multiply(matrix, solution, rhs);
+
+    std::vector<Point3D> x(NodesNumber);
+
+    ConjugateGradientSolver<Point3D> solver(Tolerance, 1000u);
+    EXPECT_TRUE(solver.solve(matrix, rhs, x).converged);
+
+    for (size_t i = 0; i < NodesNumber; i++)
+        EXPECT_NEAR(0., (solution[i] - x[i]).calcNorm(), 1e-8);
+}
+
+void LinearSolversTestSuite::iterationsLimit()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2.5, -1., -1.);
+
+    std::vector<double> rhs;
+    SPHAlgorithms::multiply(matrix, createSolution(), rhs);
+
+    std::vector<double> x(NodesNumber, 0.);
+
+    JacobiSolver<double> solver(Tolerance, 3u);
+    solver.solve(matrix, rhs, x);
+
+    EXPECT_FALSE(solver.getStatistics().converged);
+    EXPECT_EQ(3u, solver.getStatistics().iterationsNumber);
+    EXPECT_LT(Tolerance, solver.getStatistics().residual);
+}
+
+void LinearSolversTestSuite::zeroRightHandSide()
+{
+    const NeighbourMatrix matrix = createChainMatrix(2.5, -1., -1.);
+
+    const std::vector<double> rhs(NodesNumber, 0.);
+    std::vector<double> x(NodesNumber, 1.);
+
+    BiConjugateGradientStabilizedSolver<double> solver(Tolerance, 1000u);
+    solver.solve(matrix, rhs, x);
+
+    EXPECT_TRUE(solver.getStatistics().converged);
+    EXPECT_EQ(0u, solver.getStatistics().iterationsNumber);
+
+    for (const double value : x)
+        EXPECT_EQ(0., value);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+using namespace SPHAlgorithms::TestEnvironment;
+
+TEST(LinearSolversTestSuite, multiply)
+{
+    LinearSolversTestSuite::multiply();
+}
+
+TEST(LinearSolversTestSuite, dotProduct)
+{
+    LinearSolversTestSuite::dotProduct();
+}
+
+TEST(LinearSolversTestSuite, jacobi)
+{
+    LinearSolversTestSuite::jacobi();
+}
+
+TEST(LinearSolversTestSuite, gaussSeidel)
+{
+    LinearSolversTestSuite::gaussSeidel();
+}
+
+TEST(LinearSolversTestSuite, conjugateGradient)
+{
+    LinearSolversTestSuite::conjugateGradient();
+}
+
+TEST(LinearSolversTestSuite, biConjugateGradientStabilized)
+{
+    LinearSolversTestSuite::biConjugateGradientStabilized();
+}
+
+TEST(LinearSolversTestSuite, vectorValues)
+{
+    LinearSolversTestSuite::vectorValues();
+}
+
+TEST(LinearSolversTestSuite, iterationsLimit)
+{
+    LinearSolversTestSuite::iterationsLimit();
+}
+
+TEST(LinearSolversTestSuite, zeroRightHandSide)
+{
+    LinearSolversTestSuite::zeroRightHandSide();
+}
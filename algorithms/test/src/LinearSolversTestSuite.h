@@ -0,0 +1,41 @@
+/**
+ * @file LinearSolversTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef LINEAR_SOLVERS_TEST_SUITE_H_D01C0817F6CF441F890F923A2AD32079
+#define LINEAR_SOLVERS_TEST_SUITE_H_D01C0817F6CF441F890F923A2AD32079
+
+namespace SPHAlgorithms
+{
+
+namespace TestEnvironment
+{
+
+class LinearSolversTestSuite
+{
+public:
+    static void multiply();
+
+    static void dotProduct();
+
+    static void jacobi();
+
+    static void gaussSeidel();
+
+    static void conjugateGradient();
+
+    static void biConjugateGradientStabilized();
+
+    static void vectorValues();
+
+    static void iterationsLimit();
+
+    static void zeroRightHandSide();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+#endif // LINEAR_SOLVERS_TEST_SUITE_H_D01C0817F6CF441F890F923A2AD32079
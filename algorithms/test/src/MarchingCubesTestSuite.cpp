@@ -63,6 +63,44 @@ void MarchingCubesTestSuite::generateBishopMesh()
     generateObjFile(mesh, "bishop.obj");
 }
 
+void MarchingCubesTestSuite::generatePawnMeshAdaptive()
+{
+    size_t evaluations = 0u;
+    const auto pawn = [&evaluations](float x, float y, float z) {
+        ++evaluations;
+        return Shapes::Pawn(x, y, z);
+    };
+
+    const Point3FVector mesh = SPHAlgorithms::MarchingCubes::generateMeshAdaptive(pawn);
+
+    ASSERT_EQ(37128u, mesh.size());
+
+    // the uniform grid evaluates 8 vertices for every one of 100^3 grid cubes
+    EXPECT_GT(8000000u / 25u, evaluations);
+}
+
+void MarchingCubesTestSuite::generateBishopMeshAdaptive()
+{
+    size_t evaluations = 0u;
+    const auto bishop = [&evaluations](float x, float y, float z) {
+        ++evaluations;
+        return Shapes::Bishop(x, y, z);
+    };
+
+    const Point3FVector mesh = SPHAlgorithms::MarchingCubes::generateMeshAdaptive(bishop);
+
+    ASSERT_EQ(45552u, mesh.size());
+
+    EXPECT_GT(8000000u / 25u, evaluations);
+}
+
+void MarchingCubesTestSuite::generatePawnExpressionMesh()
+{
+    const Point3FVector mesh = SPHAlgorithms::MarchingCubes::generateMeshAdaptive(Shapes::PawnExpression());
+
+    ASSERT_EQ(37128u, mesh.size());
+}
+
 } // namespace TestEnvironment
 } // namespace SPHAlgorithms
 
@@ -77,3 +115,18 @@ TEST(MarchingCubesTestSuite, generateBishopMesh)
 {
     MarchingCubesTestSuite::generateBishopMesh();
 }
+
+TEST(MarchingCubesTestSuite, generatePawnMeshAdaptive)
+{
+    MarchingCubesTestSuite::generatePawnMeshAdaptive();
+}
+
+TEST(MarchingCubesTestSuite, generateBishopMeshAdaptive)
+{
+    MarchingCubesTestSuite::generateBishopMeshAdaptive();
+}
+
+TEST(MarchingCubesTestSuite, generatePawnExpressionMesh)
+{
+    MarchingCubesTestSuite::generatePawnExpressionMesh();
+}
@@ -20,6 +20,12 @@ public:
     static void generatePawnMesh();
 
     static void generateBishopMesh();
+
+    static void generatePawnMeshAdaptive();
+
+    static void generateBishopMeshAdaptive();
+
+    static void generatePawnExpressionMesh();
 };
 
 } // namespace TestEnvironment
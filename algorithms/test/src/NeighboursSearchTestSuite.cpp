@@ -11,6 +11,8 @@
 
 #include "Area.h"
 #include "NeighboursSearch.h"
+#include <algorithm>
+#include <random>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -106,11 +108,27 @@ void NeighboursSearchTestSuite::testSearch3D(const Cuboid&             cuboid,
     for (size_t i = 0u; i < boxesSize; ++i)
         EXPECT_EQ(expectedBoxSizes[i], ns.m_boxes[i].size());
 
+    // the stencil visits the nearby boxes in the order of their numbering
     for (size_t i = 0u; i < boxesSize; ++i)
-        EXPECT_EQ(expectedBoxNeighbours[i], ns.m_nearbyBoxes[i]);
+    {
+        SizetVector expectedNearbyBoxes = expectedBoxNeighbours[i];
+        std::sort(expectedNearbyBoxes.begin(), expectedNearbyBoxes.end());
+
+        SizetVector nearbyBoxes;
+        ns.forEachNearbyBox(i, [&nearbyBoxes](size_t nearbyBoxIndex) { nearbyBoxes.push_back(nearbyBoxIndex); });
 
+        EXPECT_EQ(expectedNearbyBoxes, nearbyBoxes);
+    }
+
+    // the neighbours are found in the order of the visited boxes
     for (size_t i = 0u; i < points.size(); ++i)
-        EXPECT_EQ(expectedPointNeighbours[i], points[i].neighbours);
+    {
+        SizetVector expectedNeighbours = expectedPointNeighbours[i];
+        std::sort(expectedNeighbours.begin(), expectedNeighbours.end());
+        std::sort(points[i].neighbours.begin(), points[i].neighbours.end());
+
+        EXPECT_EQ(expectedNeighbours, points[i].neighbours);
+    }
 }
 
 void NeighboursSearchTestSuite::testInsert3D(const Cuboid&               cuboid,
@@ -456,6 +474,433 @@ void NeighboursSearchTestSuite::searchInDifferentBoxesCenterMiddle3D()
                  } );                    // expectedNeighbours
 }
 
+void NeighboursSearchTestSuite::findPointsNearCuboid3D()
+{
+    TestPoints3D points = { Point3D(0.05, 0.05, 0.05),
+                            Point3D(0.55, 0.55, 0.55),
+                            Point3D(0.35, 0.55, 0.55),
+                            Point3D(0.95, 0.95, 0.95) };
+
+    NeighboursSearch3D<TestPoints3D> ns(Volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.)), 0.1, 0.001);
+    ns.search(points);
+
+    // the boxes overlapping the cuboid expanded by one box
+    EXPECT_EQ(SizetVector({ 1 }), ns.findPointsNearCuboid(Cuboid(Point3D(0.5, 0.5, 0.5), 0.05, 0.05, 0.05)));
+    EXPECT_EQ(SizetVector({ 2, 1 }), ns.findPointsNearCuboid(Cuboid(Point3D(0.3, 0.5, 0.5), 0.25, 0.05, 0.05)));
+
+    // the cuboid partially outside of the volume
+    EXPECT_EQ(SizetVector({ 0 }), ns.findPointsNearCuboid(Cuboid(Point3D(-0.2, -0.2, -0.2), 0.1, 0.1, 0.1)));
+    EXPECT_EQ(SizetVector({ 0, 2, 1, 3 }), ns.findPointsNearCuboid(Cuboid(Point3D(-1., -1., -1.), 3., 3., 3.)));
+
+    // the cuboid outside of the volume
+    EXPECT_TRUE(ns.findPointsNearCuboid(Cuboid(Point3D(2., 2., 2.), 1., 1., 1.)).empty());
+
+    // the corner box and its neighbours
+    EXPECT_EQ(SizetVector({ 0, 1, 10, 11, 100, 101, 110, 111 }),
+              ns.findBoxesNearCuboid(Cuboid(Point3D(0.01, 0.01, 0.01), 0.01, 0.01, 0.01)));
+    EXPECT_EQ(SizetVector({ 0 }), ns.getPointsInBox(0));
+}
+
+void NeighboursSearchTestSuite::searchInDomain3D()
+{
+    // the cylindrical tank with radius 1 along z axis
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 2., 2., 2.),
+                        [](float x, float y, float) { return 1.f - (x - 1.f) * (x - 1.f) - (y - 1.f) * (y - 1.f); },
+                        0.05);
+
+    TestPoints3D points = { Point3D(1.05, 1.05, 0.05),
+                            Point3D(1.15, 1.05, 0.05),
+                            Point3D(1.85, 1.05, 1.95) };
+
+    NeighboursSearch3D<TestPoints3D> ns(volume, 0.2, 0.001);
+
+    // the corner boxes outside of the tank are skipped
+    EXPECT_LT(ns.m_activeBoxes.size(), ns.m_boxesNumber);
+    EXPECT_GT(ns.m_activeBoxes.size(), ns.m_boxesNumber * 3u / 4u);
+
+    ns.search(points);
+
+    EXPECT_EQ(SizetVector({ 1 }), points[0].neighbours);
+    EXPECT_EQ(SizetVector({ 0 }), points[1].neighbours);
+    EXPECT_TRUE(points[2].neighbours.empty());
+}
+
+void NeighboursSearchTestSuite::searchInShiftedVolume3D()
+{
+    TestPoints3D points = { Point3D(-0.95, -0.95, -0.95),
+                            Point3D(-0.9, -0.95, -0.95),
+                            Point3D(0.95, 0.95, 0.95) };
+
+    NeighboursSearch3D<TestPoints3D> ns(Volume(Cuboid(Point3D(-1., -1., -1.), 2., 2., 2.)), 0.1, 0.001);
+    ns.search(points);
+
+    EXPECT_EQ(SizetVector({ 0, 1 }), ns.getPointsInBox(0));
+    EXPECT_EQ(SizetVector({ 1 }), points[0].neighbours);
+    EXPECT_EQ(SizetVector({ 2 }), ns.findPointsNearCuboid(Cuboid(Point3D(0.9, 0.9, 0.9), 0.05, 0.05, 0.05)));
+}
+
+void NeighboursSearchTestSuite::searchInHashedBoxes3D()
+{
+    std::mt19937 generator(17u);
+    std::uniform_real_distribution<double> coordinate(0., 1.);
+
+    TestPoints3D densePoints;
+    for (size_t i = 0u; i < 500u; i++)
+    {
+        const double x = coordinate(generator);
+        const double y = coordinate(generator);
+        const double z = coordinate(generator);
+        densePoints.push_back(TestPoint3D(Point3D(x, y, z)));
+    }
+
+    TestPoints3D hashedPoints = densePoints;
+
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.));
+
+    NeighboursSearch3D<TestPoints3D> denseSearch(volume, 0.1, 0.001);
+    NeighboursSearch3D<TestPoints3D> hashedSearch(volume, 0.1, 0.001, NeighboursSearch3D<TestPoints3D>::hashed);
+
+    // nothing is allocated before the search
+    EXPECT_TRUE(hashedSearch.m_boxes.empty());
+
+    denseSearch.search(densePoints);
+    hashedSearch.search(hashedPoints);
+
+    EXPECT_GE(1000u, hashedSearch.m_boxes.size());
+
+    for (size_t i = 0u; i < densePoints.size(); i++)
+    {
+        std::sort(densePoints[i].neighbours.begin(), densePoints[i].neighbours.end());
+        std::sort(hashedPoints[i].neighbours.begin(), hashedPoints[i].neighbours.end());
+
+        EXPECT_EQ(densePoints[i].neighbours, hashedPoints[i].neighbours);
+    }
+
+    const Cuboid cuboid(Point3D(0.3, 0.4, 0.5), 0.2, 0.1, 0.3);
+    SizetVector densePointsNearCuboid = denseSearch.findPointsNearCuboid(cuboid);
+    SizetVector hashedPointsNearCuboid = hashedSearch.findPointsNearCuboid(cuboid);
+    std::sort(densePointsNearCuboid.begin(), densePointsNearCuboid.end());
+    std::sort(hashedPointsNearCuboid.begin(), hashedPointsNearCuboid.end());
+
+    EXPECT_EQ(densePointsNearCuboid, hashedPointsNearCuboid);
+    EXPECT_EQ(hashedPoints.size(),
+              hashedSearch.findPointsNearCuboid(Cuboid(Point3D(-5., -5., -5.), 10., 10., 10.)).size());
+}
+
+void NeighboursSearchTestSuite::searchOutsideOfVolume3D()
+{
+    // the channel is much longer than the volume of the search
+    TestPoints3D points = { Point3D(-0.05, 0.5, 0.5),
+                            Point3D(0.02, 0.5, 0.5),
+                            Point3D(100.5, 0.5, 0.5),
+                            Point3D(100.55, 0.5, 0.5),
+                            Point3D(-2000., 0.5, 0.5) };
+
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.));
+
+    NeighboursSearch3D<TestPoints3D> hashedSearch(volume, 0.1, 0.001, NeighboursSearch3D<TestPoints3D>::hashed);
+    hashedSearch.search(points);
+
+    EXPECT_EQ(4u, hashedSearch.m_boxes.size());
+    EXPECT_EQ(SizetVector({ 1 }), points[0].neighbours);
+    EXPECT_EQ(SizetVector({ 3 }), points[2].neighbours);
+    EXPECT_TRUE(points[4].neighbours.empty());
+    EXPECT_EQ(SizetVector({ 2, 3 }), hashedSearch.findPointsNearCuboid(Cuboid(Point3D(100.5, 0.5, 0.5), 0., 0., 0.)));
+
+    // the dense grid puts the points outside of the volume into the border boxes
+    NeighboursSearch3D<TestPoints3D> denseSearch(volume, 0.1, 0.001);
+    denseSearch.search(points);
+
+    EXPECT_EQ(SizetVector({ 0, 1, 4 }), denseSearch.getPointsInBox(55u * 10u));
+    EXPECT_EQ(SizetVector({ 1 }), points[0].neighbours);
+}
+
+void NeighboursSearchTestSuite::searchIncremental3D()
+{
+    std::mt19937 generator(23u);
+    std::uniform_real_distribution<double> coordinate(0., 1.);
+    std::uniform_real_distribution<double> shift(-0.01, 0.01);
+
+    TestPoints3D points;
+    for (size_t i = 0u; i < 500u; i++)
+    {
+        const double x = coordinate(generator);
+        const double y = coordinate(generator);
+        const double z = coordinate(generator);
+        points.push_back(TestPoint3D(Point3D(x, y, z)));
+    }
+
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.));
+
+    NeighboursSearch3D<TestPoints3D> fullSearch(volume, 0.1, 0.001);
+    NeighboursSearch3D<TestPoints3D> incrementalSearch(volume, 0.1, 0.001);
+    incrementalSearch.setIncremental(true);
+
+    // the first search puts all the points
+    incrementalSearch.search(points);
+    EXPECT_EQ(points.size(), incrementalSearch.getMovedPointsNumber());
+
+    for (size_t step = 0u; step < 5u; step++)
+    {
+        size_t movedPointsNumber = 0u;
+
+        for (TestPoint3D& point : points)
+        {
+            const size_t box = incrementalSearch.getBoxIndex(point.position);
+            point.position = Point3D(std::min(std::max(point.position.x + shift(generator), 0.), 1.),
+                                     std::min(std::max(point.position.y + shift(generator), 0.), 1.),
+                                     std::min(std::max(point.position.z + shift(generator), 0.), 1.));
+
+            if (box != incrementalSearch.getBoxIndex(point.position))
+                ++movedPointsNumber;
+        }
+
+        TestPoints3D fullPoints = points;
+        fullSearch.search(fullPoints);
+        incrementalSearch.search(points);
+
+        // only a part of the points changed their boxes
+        EXPECT_EQ(movedPointsNumber, incrementalSearch.getMovedPointsNumber());
+        EXPECT_GT(points.size() / 2u, movedPointsNumber);
+
+        for (size_t boxIndex = 0u; boxIndex < fullSearch.m_boxesNumber; boxIndex++)
+        {
+            SizetVector boxPoints = incrementalSearch.getPointsInBox(boxIndex);
+            std::sort(boxPoints.begin(), boxPoints.end());
+            EXPECT_EQ(fullSearch.getPointsInBox(boxIndex), boxPoints);
+        }
+
+        for (size_t i = 0u; i < points.size(); i++)
+        {
+            std::sort(fullPoints[i].neighbours.begin(), fullPoints[i].neighbours.end());
+            std::sort(points[i].neighbours.begin(), points[i].neighbours.end());
+            EXPECT_EQ(fullPoints[i].neighbours, points[i].neighbours);
+        }
+    }
+
+    // the changed amount of points puts all of them again
+    points.pop_back();
+    incrementalSearch.search(points);
+    EXPECT_EQ(points.size(), incrementalSearch.getMovedPointsNumber());
+}
+
+/// NeighboursSearch3D with the static points tests
+
+void NeighboursSearchTestSuite::searchStaticPoints3D()
+{
+    std::mt19937 generator(29u);
+    std::uniform_real_distribution<double> coordinate(0., 1.);
+    std::uniform_real_distribution<double> shift(-0.05, 0.05);
+
+    TestPoints3D points;
+    TestPoints3D staticPoints;
+    for (size_t i = 0u; i < 800u; i++)
+    {
+        const double x = coordinate(generator);
+        const double y = coordinate(generator);
+        const double z = coordinate(generator);
+        (i % 2u == 0u ? points : staticPoints).push_back(TestPoint3D(Point3D(x, y, z)));
+    }
+
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.));
+    const double radius = 0.1;
+
+    NeighboursSearch3D<TestPoints3D> search(volume, radius, 0.001);
+    NeighboursSearch3D<TestPoints3D> dynamicSearch(volume, radius, 0.001);
+    search.setIncremental(true);
+    search.setStaticPoints(staticPoints);
+
+    EXPECT_EQ(staticPoints.size(), search.getStaticPointsNumber());
+
+    VectorOfSizetVectors staticNeighbours;
+
+    for (size_t step = 0u; step < 3u; step++)
+    {
+        TestPoints3D dynamicPoints = points;
+        dynamicSearch.search(dynamicPoints);
+        search.search(points, staticNeighbours);
+
+        // the static points are found by the brute force and the dynamic neighbours are not changed by them
+        ASSERT_EQ(points.size(), staticNeighbours.size());
+
+        for (size_t i = 0u; i < points.size(); i++)
+        {
+            SizetVector expectedNeighbours;
+            for (size_t j = 0u; j < staticPoints.size(); j++)
+            {
+                if ((points[i].position - staticPoints[j].position).calcNormSqr() <= radius * radius)
+                    expectedNeighbours.push_back(j);
+            }
+
+            std::sort(staticNeighbours[i].begin(), staticNeighbours[i].end());
+            EXPECT_EQ(expectedNeighbours, staticNeighbours[i]);
+
+            // the incremental boxes are not sorted
+            std::sort(dynamicPoints[i].neighbours.begin(), dynamicPoints[i].neighbours.end());
+            std::sort(points[i].neighbours.begin(), points[i].neighbours.end());
+            EXPECT_EQ(dynamicPoints[i].neighbours, points[i].neighbours);
+        }
+
+        // only the dynamic points are moved
+        for (TestPoint3D& point : points)
+            point.position = Point3D(std::min(std::max(point.position.x + shift(generator), 0.), 1.),
+                                     std::min(std::max(point.position.y + shift(generator), 0.), 1.),
+                                     std::min(std::max(point.position.z + shift(generator), 0.), 1.));
+
+        EXPECT_GE(points.size(), search.getMovedPointsNumber());
+    }
+
+    // the static points have no neighbours
+    for (const TestPoint3D& point : staticPoints)
+        EXPECT_TRUE(point.neighbours.empty());
+
+    search.setStaticPoints(TestPoints3D());
+    search.search(points, staticNeighbours);
+
+    EXPECT_EQ(0u, search.getStaticPointsNumber());
+    for (const SizetVector& neighbours : staticNeighbours)
+        EXPECT_TRUE(neighbours.empty());
+}
+
+/// NeighboursSearch3D with the periodic axes tests
+
+void NeighboursSearchTestSuite::searchPeriodic3D()
+{
+    std::mt19937 generator(31u);
+    std::uniform_real_distribution<double> coordinate(0., 1.);
+    std::uniform_real_distribution<double> shift(-0.05, 0.05);
+
+    // the periodic z axis has two boxes only, so every box along it is nearby
+    const Cuboid cuboid(Point3D(0., 0., 0.), 1., 1., 0.25);
+    const Periodicity periodicity(cuboid, true, false, true);
+    const double radius = 0.1;
+
+    TestPoints3D points;
+    TestPoints3D staticPoints;
+    for (size_t i = 0u; i < 600u; i++)
+    {
+        const Point3D position(coordinate(generator), coordinate(generator), 0.25 * coordinate(generator));
+        (i % 2u == 0u ? points : staticPoints).push_back(TestPoint3D(position));
+    }
+
+    NeighboursSearch3D<TestPoints3D> search(Volume(cuboid), radius, 0.001);
+    search.setIncremental(true);
+    search.setPeriodicity(periodicity);
+    search.setStaticPoints(staticPoints);
+
+    EXPECT_TRUE(search.getPeriodicity().isPeriodic(0u));
+    EXPECT_FALSE(search.getPeriodicity().isPeriodic(1u));
+
+    VectorOfSizetVectors staticNeighbours;
+    size_t crossingPairsNumber = 0u;
+
+    for (size_t step = 0u; step < 3u; step++)
+    {
+        search.search(points, staticNeighbours);
+
+        // the neighbours are found by the brute force over the nearest images
+        for (size_t i = 0u; i < points.size(); i++)
+        {
+            SizetVector expectedNeighbours;
+            for (size_t j = 0u; j < points.size(); j++)
+            {
+                const Point3D difference = points[i].position - points[j].position;
+
+                if (i != j && periodicity.calcMinimumImage(difference).calcNormSqr() <= radius * radius)
+                {
+                    expectedNeighbours.push_back(j);
+
+                    if (difference.calcNormSqr() > radius * radius)
+                        crossingPairsNumber++;
+                }
+            }
+
+            SizetVector expectedStaticNeighbours;
+            for (size_t j = 0u; j < staticPoints.size(); j++)
+            {
+                const Point3D difference = points[i].position - staticPoints[j].position;
+
+                if (periodicity.calcMinimumImage(difference).calcNormSqr() <= radius * radius)
+                    expectedStaticNeighbours.push_back(j);
+            }
+
+            std::sort(points[i].neighbours.begin(), points[i].neighbours.end());
+            EXPECT_EQ(expectedNeighbours, points[i].neighbours);
+
+            std::sort(staticNeighbours[i].begin(), staticNeighbours[i].end());
+            EXPECT_EQ(expectedStaticNeighbours, staticNeighbours[i]);
+        }
+
+        // the points leave through the periodic faces and enter through the opposite ones
+        for (TestPoint3D& point : points)
+            point.position = periodicity.wrap(
+                Point3D(point.position.x + shift(generator),
+                        std::min(std::max(point.position.y + shift(generator), 0.), 1.),
+                        point.position.z + shift(generator)));
+    }
+
+    EXPECT_LT(0u, crossingPairsNumber);
+
+    // the wrapped positions are inside of the cuboid
+    for (const TestPoint3D& point : points)
+    {
+        EXPECT_LE(0., point.position.x);
+        EXPECT_GT(1., point.position.x);
+        EXPECT_LE(0., point.position.z);
+        EXPECT_GT(0.25, point.position.z);
+    }
+}
+
+/// MultiLevelNeighboursSearch3D::search() tests
+
+void NeighboursSearchTestSuite::searchMultiLevel3D()
+{
+    std::mt19937 generator(29u);
+    std::uniform_real_distribution<double> coordinate(0., 1.);
+
+    // the last radius is larger than the coarsest level
+    const double supportRadii[] = {0.05, 0.08, 0.1, 0.2, 0.3};
+    std::uniform_int_distribution<size_t> supportRadiusIndex(0u, 4u);
+
+    TestPoints3D points;
+    for (size_t i = 0u; i < 400u; i++)
+    {
+        const double x = coordinate(generator);
+        const double y = coordinate(generator);
+        const double z = coordinate(generator);
+        points.push_back(TestPoint3D(Point3D(x, y, z)));
+        points.back().supportRadius = supportRadii[supportRadiusIndex(generator)];
+    }
+
+    const Volume volume(Cuboid(Point3D(0., 0., 0.), 1., 1., 1.));
+
+    MultiLevelNeighboursSearch3D<TestPoints3D> search(volume, {0.2, 0.05, 0.1});
+
+    EXPECT_EQ(3u, search.getLevelsNumber());
+    EXPECT_EQ(0u, search.getLevel(0.05));
+    EXPECT_EQ(1u, search.getLevel(0.08));
+    EXPECT_EQ(1u, search.getLevel(0.1));
+    EXPECT_EQ(2u, search.getLevel(0.3));
+
+    search.search(points);
+
+    for (size_t i = 0u; i < points.size(); i++)
+    {
+        SizetVector expectedNeighbours;
+
+        for (size_t j = 0u; j < points.size(); j++)
+        {
+            const double supportRadius = 0.5 * (points[i].supportRadius + points[j].supportRadius);
+
+            if (j != i && (points[i].position - points[j].position).calcNorm() <= supportRadius)
+                expectedNeighbours.push_back(j);
+        }
+
+        std::sort(points[i].neighbours.begin(), points[i].neighbours.end());
+        EXPECT_EQ(expectedNeighbours, points[i].neighbours);
+    }
+}
+
 /// NeighboursSearch::insertPointsIntoBoxes() tests
 
 void NeighboursSearchTestSuite::insertPointsIntoBoxesCornerPoints()
@@ -1201,6 +1646,51 @@ TEST(NeighboursSearchTestSuite, searchInDifferentBoxesCenterMiddle3D)
     NeighboursSearchTestSuite::searchInDifferentBoxesCenterMiddle3D();
 }
 
+TEST(NeighboursSearchTestSuite, findPointsNearCuboid3D)
+{
+    NeighboursSearchTestSuite::findPointsNearCuboid3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchInDomain3D)
+{
+    NeighboursSearchTestSuite::searchInDomain3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchInShiftedVolume3D)
+{
+    NeighboursSearchTestSuite::searchInShiftedVolume3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchInHashedBoxes3D)
+{
+    NeighboursSearchTestSuite::searchInHashedBoxes3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchOutsideOfVolume3D)
+{
+    NeighboursSearchTestSuite::searchOutsideOfVolume3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchIncremental3D)
+{
+    NeighboursSearchTestSuite::searchIncremental3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchStaticPoints3D)
+{
+    NeighboursSearchTestSuite::searchStaticPoints3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchPeriodic3D)
+{
+    NeighboursSearchTestSuite::searchPeriodic3D();
+}
+
+TEST(NeighboursSearchTestSuite, searchMultiLevel3D)
+{
+    NeighboursSearchTestSuite::searchMultiLevel3D();
+}
+
 //-------------------------------------------------
 
 TEST(NeighboursSearchTestSuite, insertPointsIntoBoxesCornerPoints)
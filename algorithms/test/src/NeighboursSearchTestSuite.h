@@ -58,6 +58,31 @@ public:
 
     static void searchInDifferentBoxesCenterMiddle3D();
 
+    /// NeighboursSearch3D::findPointsNearCuboid() tests
+    static void findPointsNearCuboid3D();
+
+    /// NeighboursSearch3D with the domain and the shifted volume tests
+    static void searchInDomain3D();
+
+    static void searchInShiftedVolume3D();
+
+    /// NeighboursSearch3D with the hashed grid tests
+    static void searchInHashedBoxes3D();
+
+    static void searchOutsideOfVolume3D();
+
+    /// NeighboursSearch3D with the incremental grid tests
+    static void searchIncremental3D();
+
+    /// NeighboursSearch3D with the static points tests
+    static void searchStaticPoints3D();
+
+    /// NeighboursSearch3D with the periodic axes tests
+    static void searchPeriodic3D();
+
+    /// MultiLevelNeighboursSearch3D::search() tests
+    static void searchMultiLevel3D();
+
     /// NeighboursSearch::insertPointsIntoBoxes() tests
     static void insertPointsIntoBoxesCornerPoints();
 
@@ -127,10 +152,12 @@ private:
 
     struct TestPoint3D
     {
-        TestPoint3D(SPHAlgorithms::Point3D _position) : position(_position) {}
+        TestPoint3D(SPHAlgorithms::Point3D _position) : position(_position), supportRadius(0.) {}
 
         SPHAlgorithms::Point3D position;
 
+        double supportRadius;
+
         SPHAlgorithms::SizetVector neighbours;
     };
 
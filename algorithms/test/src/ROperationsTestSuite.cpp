@@ -29,6 +29,12 @@ void ROperationsTestSuite::testDisjunction()
     EXPECT_DOUBLE_EQ(3. + std::sqrt(5.), ROperations::disjunction(2., 1.));
 }
 
+void ROperationsTestSuite::testNegation()
+{
+    EXPECT_DOUBLE_EQ(-1., ROperations::negation(1.));
+    EXPECT_DOUBLE_EQ(2., ROperations::negation(-2.));
+}
+
 } // namespace TestEnvironment
 } // namespace SPHAlgorithms
 
@@ -43,3 +49,8 @@ TEST(ROperationsTestSuite, testDisjunction)
 {
     ROperationsTestSuite::testDisjunction();
 }
+
+TEST(ROperationsTestSuite, testNegation)
+{
+    ROperationsTestSuite::testNegation();
+}
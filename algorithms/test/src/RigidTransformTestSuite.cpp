@@ -0,0 +1,112 @@
+/**
+ * @file RigidTransformTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "RigidTransformTestSuite.h"
+
+#include "RigidTransform.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHAlgorithms
+{
+namespace TestEnvironment
+{
+
+static const double HalfPi = 1.57079632679489661923;
+
+static void expectNear(const Point3D& expected, const Point3D& actual)
+{
+    EXPECT_NEAR(expected.x, actual.x, 1e-12);
+    EXPECT_NEAR(expected.y, actual.y, 1e-12);
+    EXPECT_NEAR(expected.z, actual.z, 1e-12);
+}
+
+void RigidTransformTestSuite::translation()
+{
+    const RigidTransform transform(Point3D(1., 2., 3.));
+
+    expectNear(Point3D(1.5, 2., 3.), transform.toWorld(Point3D(0.5, 0., 0.)));
+    expectNear(Point3D(0.5, 0., 0.), transform.toLocal(Point3D(1.5, 2., 3.)));
+
+    // directions are not translated
+    expectNear(Point3D(0., 1., 0.), transform.rotate(Point3D(0., 1., 0.)));
+}
+
+void RigidTransformTestSuite::rotation()
+{
+    // a quarter turn around z axis, the axis length does not matter
+    const RigidTransform transform = RigidTransform::fromAxisAngle(Point3D(0., 0., 2.), HalfPi, Point3D(1., 0., 0.));
+
+    expectNear(Point3D(1., 1., 0.), transform.toWorld(Point3D(1., 0., 0.)));
+    expectNear(Point3D(0., 1., 0.), transform.rotate(Point3D(1., 0., 0.)));
+    expectNear(Point3D(1., 0., 0.), transform.inverseRotate(Point3D(0., 1., 0.)));
+
+    const Point3D point(0.3, -0.7, 0.2);
+    expectNear(point, transform.toLocal(transform.toWorld(point)));
+
+    // the zero axis gives no rotation
+    expectNear(point, RigidTransform::fromAxisAngle(Point3D(), HalfPi).toWorld(point));
+}
+
+void RigidTransformTestSuite::composition()
+{
+    const RigidTransform rotation = RigidTransform::fromAxisAngle(Point3D(0., 0., 1.), HalfPi);
+    const RigidTransform translation(Point3D(0., 0., 1.));
+
+    // the rotation is applied first
+    const RigidTransform transform = translation * rotation;
+    expectNear(Point3D(0., 1., 1.), transform.toWorld(Point3D(1., 0., 0.)));
+    expectNear(Point3D(0., 1., 1.), transform.getTranslation() + Point3D(0., 1., 0.));
+
+    double matrix[16];
+    transform.getMatrix(matrix);
+    EXPECT_NEAR(1., matrix[1], 1e-12);
+    EXPECT_NEAR(-1., matrix[4], 1e-12);
+    EXPECT_NEAR(1., matrix[14], 1e-12);
+    EXPECT_NEAR(1., matrix[15], 1e-12);
+}
+
+void RigidTransformTestSuite::cuboidBounds()
+{
+    const RigidTransform transform = RigidTransform::fromAxisAngle(Point3D(0., 0., 1.), HalfPi, Point3D(1., 1., 1.));
+
+    const Cuboid bounds = transform.toWorld(Cuboid(Point3D(0., 0., 0.), 2., 1., 3.));
+
+    expectNear(Point3D(0., 1., 1.), bounds.startingPoint);
+    EXPECT_NEAR(1., bounds.width, 1e-12);
+    EXPECT_NEAR(2., bounds.length, 1e-12);
+    EXPECT_NEAR(3., bounds.height, 1e-12);
+
+    const Cuboid localBounds = transform.toLocal(bounds);
+
+    expectNear(Point3D(0., 0., 0.), localBounds.startingPoint);
+    EXPECT_NEAR(2., localBounds.width, 1e-12);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+using namespace SPHAlgorithms::TestEnvironment;
+
+TEST(RigidTransformTestSuite, translation)
+{
+    RigidTransformTestSuite::translation();
+}
+
+TEST(RigidTransformTestSuite, rotation)
+{
+    RigidTransformTestSuite::rotation();
+}
+
+TEST(RigidTransformTestSuite, composition)
+{
+    RigidTransformTestSuite::composition();
+}
+
+TEST(RigidTransformTestSuite, cuboidBounds)
+{
+    RigidTransformTestSuite::cuboidBounds();
+}
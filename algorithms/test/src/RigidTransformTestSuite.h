@@ -0,0 +1,31 @@
+/**
+ * @file RigidTransformTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef RIGID_TRANSFORM_TEST_SUITE_H_3D9A1F6C2E8B4D7A5C0E9B1F4A6D2C83
+#define RIGID_TRANSFORM_TEST_SUITE_H_3D9A1F6C2E8B4D7A5C0E9B1F4A6D2C83
+
+namespace SPHAlgorithms
+{
+
+namespace TestEnvironment
+{
+
+class RigidTransformTestSuite
+{
+public:
+    static void translation();
+
+    static void rotation();
+
+    static void composition();
+
+    static void cuboidBounds();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+#endif // RIGID_TRANSFORM_TEST_SUITE_H_3D9A1F6C2E8B4D7A5C0E9B1F4A6D2C83
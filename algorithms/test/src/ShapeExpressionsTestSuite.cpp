@@ -0,0 +1,199 @@
+/**
+ * @file ShapeExpressionsTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "ShapeExpressionsTestSuite.h"
+
+#include "ShapeExpressions.h"
+#include "Shapes.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHAlgorithms
+{
+namespace TestEnvironment
+{
+
+using namespace ShapeExpressions;
+
+void ShapeExpressionsTestSuite::pawnExpression()
+{
+    const auto pawn = Shapes::PawnExpression();
+
+    for (float x = 0.f; x < 3.f; x += 0.1f)
+    {
+        for (float y = 0.f; y < 3.f; y += 0.1f)
+        {
+            for (float z = 0.f; z < 3.f; z += 0.1f)
+            {
+                ASSERT_NEAR(Shapes::Pawn(x, y, z), pawn(x, y, z), 1e-3f * (1.f + std::abs(Shapes::Pawn(x, y, z))));
+            }
+        }
+    }
+}
+
+void ShapeExpressionsTestSuite::bishopExpression()
+{
+    const auto bishop = Shapes::BishopExpression();
+
+    for (float x = 0.f; x < 3.f; x += 0.1f)
+    {
+        for (float y = 0.f; y < 3.f; y += 0.1f)
+        {
+            for (float z = 0.f; z < 3.f; z += 0.1f)
+            {
+                ASSERT_NEAR(Shapes::Bishop(x, y, z), bishop(x, y, z),
+                            1e-3f * (1.f + std::abs(Shapes::Bishop(x, y, z))));
+            }
+        }
+    }
+}
+
+void ShapeExpressionsTestSuite::primitives()
+{
+    const Sphere sphere(Point3F(1.f, 1.f, 1.f), 0.5f);
+    EXPECT_FLOAT_EQ(0.25f, sphere(1.f, 1.f, 1.f));
+    EXPECT_FLOAT_EQ(0.f, sphere(1.5f, 1.f, 1.f));
+    EXPECT_GT(0.f, sphere(2.f, 1.f, 1.f));
+
+    const Cylinder cylinder(Point3F(1.f, 1.f, 0.f), 0.5f, 2.f);
+    EXPECT_LT(0.f, cylinder(1.f, 1.f, 1.f));
+    EXPECT_GT(0.f, cylinder(1.f, 1.f, 2.5f));
+    EXPECT_GT(0.f, cylinder(1.7f, 1.f, 1.f));
+
+    const Box box(Point3F(), 1.f, 2.f, 3.f);
+    EXPECT_LT(0.f, box(0.5f, 1.5f, 2.5f));
+    EXPECT_GT(0.f, box(0.5f, 2.5f, 2.5f));
+    EXPECT_GT(0.f, box(-0.5f, 1.5f, 2.5f));
+
+    const HalfSpace halfSpace(Point3F(0.f, 0.f, 1.f), 1.f);
+    EXPECT_FLOAT_EQ(0.5f, halfSpace(7.f, -3.f, 0.5f));
+    EXPECT_FLOAT_EQ(-1.f, halfSpace(7.f, -3.f, 2.f));
+
+    // the union contains both spheres and the intersection contains neither of them
+    const Sphere otherSphere(Point3F(2.f, 1.f, 1.f), 0.5f);
+    EXPECT_LT(0.f, (sphere | otherSphere)(1.f, 1.f, 1.f));
+    EXPECT_LT(0.f, (sphere | otherSphere)(2.f, 1.f, 1.f));
+    EXPECT_GT(0.f, (sphere & otherSphere)(1.f, 1.f, 1.f));
+    EXPECT_GT(0.f, (sphere & otherSphere)(2.f, 1.f, 1.f));
+
+    // a double precision evaluation of the same expression
+    EXPECT_DOUBLE_EQ(0.25, sphere(1., 1., 1.));
+}
+
+void ShapeExpressionsTestSuite::negation()
+{
+    const Sphere sphere(Point3F(1.f, 1.f, 1.f), 0.5f);
+    const auto   complement = !sphere;
+
+    EXPECT_FLOAT_EQ(-0.25f, complement(1.f, 1.f, 1.f));
+    EXPECT_LT(0.f, complement(2.f, 1.f, 1.f));
+
+    // the box without the sphere
+    const auto hollowBox = Box(Point3F(), 2.f, 2.f, 2.f) & !sphere;
+    EXPECT_GT(0.f, hollowBox(1.f, 1.f, 1.f));
+    EXPECT_LT(0.f, hollowBox(0.2f, 0.2f, 0.2f));
+}
+
+void ShapeExpressionsTestSuite::transforms()
+{
+    const Sphere sphere(Point3F(), 0.5f);
+
+    const auto moved = translate(sphere, Point3F(1.f, 2.f, 3.f));
+    EXPECT_FLOAT_EQ(0.25f, moved(1.f, 2.f, 3.f));
+    EXPECT_GT(0.f, moved(0.f, 0.f, 0.f));
+
+    // the ellipsoid with the semi-axes 1, 0.5 and 0.5
+    const auto stretched = scale(sphere, Point3F(2.f, 1.f, 1.f));
+    EXPECT_NEAR(0.f, stretched(1.f, 0.f, 0.f), 1e-6f);
+    EXPECT_LT(0.f, stretched(0.9f, 0.f, 0.f));
+    EXPECT_GT(0.f, stretched(0.f, 0.9f, 0.f));
+
+    // the box along x rotated by 90 degrees around z lies along y
+    const Box  box(Point3F(0.f, -0.1f, -0.1f), 1.f, 0.2f, 0.2f);
+    const auto rotated = rotate(box, Point3F(0.f, 0.f, 1.f), 3.14159265f / 2.f);
+    EXPECT_LT(0.f, rotated(0.f, 0.5f, 0.f));
+    EXPECT_GT(0.f, rotated(0.5f, 0.f, 0.f));
+}
+
+static void expectCuboid(const Cuboid& expected, const Cuboid& actual)
+{
+    EXPECT_NEAR(expected.startingPoint.x, actual.startingPoint.x, 1e-5);
+    EXPECT_NEAR(expected.startingPoint.y, actual.startingPoint.y, 1e-5);
+    EXPECT_NEAR(expected.startingPoint.z, actual.startingPoint.z, 1e-5);
+    EXPECT_NEAR(expected.width, actual.width, 1e-5);
+    EXPECT_NEAR(expected.length, actual.length, 1e-5);
+    EXPECT_NEAR(expected.height, actual.height, 1e-5);
+}
+
+void ShapeExpressionsTestSuite::bounds()
+{
+    const Sphere sphere(Point3F(1.f, 1.f, 1.f), 0.5f);
+    expectCuboid(Cuboid(Point3D(0.5, 0.5, 0.5), 1., 1., 1.), sphere.bounds());
+
+    const Cylinder cylinder(Point3F(1.f, 1.f, 0.f), 0.5f, 2.f);
+    expectCuboid(Cuboid(Point3D(0.5, 0.5, 0.), 1., 1., 2.), cylinder.bounds());
+
+    // the half-space below z = 1 is limited only from above
+    const Cuboid halfSpace = HalfSpace(Point3F(0.f, 0.f, 2.f), 2.f).bounds();
+    EXPECT_DOUBLE_EQ(1., halfSpace.startingPoint.z + halfSpace.height);
+    EXPECT_GT(-1e6, halfSpace.startingPoint.z);
+    EXPECT_LT(1e6, halfSpace.width);
+
+    // the intersection is limited by the half-space, the union by both spheres
+    expectCuboid(Cuboid(Point3D(0.5, 0.5, 0.5), 1., 1., 0.5),
+                 (sphere & HalfSpace(Point3F(0.f, 0.f, 1.f), 1.f)).bounds());
+    expectCuboid(Cuboid(Point3D(0.5, 0.5, 0.5), 2., 1., 1.),
+                 (sphere | Sphere(Point3F(2.f, 1.f, 1.f), 0.5f)).bounds());
+
+    // the complement is unbounded
+    EXPECT_LT(1e6, (!sphere).bounds().width);
+
+    expectCuboid(Cuboid(Point3D(1.5, 0.5, 0.5), 1., 1., 1.), translate(sphere, Point3F(1.f, 0.f, 0.f)).bounds());
+    expectCuboid(Cuboid(Point3D(-3., 1., 0.5), 2., 2., 1.), scale(sphere, Point3F(-2.f, 2.f, 1.f)).bounds());
+
+    const Box box(Point3F(0.f, -0.1f, -0.1f), 1.f, 0.2f, 0.2f);
+    expectCuboid(Cuboid(Point3D(-0.1, 0., -0.1), 0.2, 1., 0.2),
+                 rotate(box, Point3F(0.f, 0.f, 1.f), 3.14159265f / 2.f).bounds());
+
+    // the pawn lies on the floor in the center of the domain
+    const Cuboid pawn = Shapes::PawnExpression().bounds();
+    expectCuboid(Cuboid(Point3D(1., 1., 0.), 1., 1., 1.25 + std::sqrt(0.05)), pawn);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+using namespace SPHAlgorithms::TestEnvironment;
+
+TEST(ShapeExpressionsTestSuite, pawnExpression)
+{
+    ShapeExpressionsTestSuite::pawnExpression();
+}
+
+TEST(ShapeExpressionsTestSuite, bishopExpression)
+{
+    ShapeExpressionsTestSuite::bishopExpression();
+}
+
+TEST(ShapeExpressionsTestSuite, primitives)
+{
+    ShapeExpressionsTestSuite::primitives();
+}
+
+TEST(ShapeExpressionsTestSuite, negation)
+{
+    ShapeExpressionsTestSuite::negation();
+}
+
+TEST(ShapeExpressionsTestSuite, transforms)
+{
+    ShapeExpressionsTestSuite::transforms();
+}
+
+TEST(ShapeExpressionsTestSuite, bounds)
+{
+    ShapeExpressionsTestSuite::bounds();
+}
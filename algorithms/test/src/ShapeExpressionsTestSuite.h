@@ -0,0 +1,35 @@
+/**
+ * @file ShapeExpressionsTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef SHAPE_EXPRESSIONS_TEST_SUITE_H_1C8E4A2F6B0D4F3E9A7C5B1D3E8F0A62
+#define SHAPE_EXPRESSIONS_TEST_SUITE_H_1C8E4A2F6B0D4F3E9A7C5B1D3E8F0A62
+
+namespace SPHAlgorithms
+{
+
+namespace TestEnvironment
+{
+
+class ShapeExpressionsTestSuite
+{
+public:
+    static void pawnExpression();
+
+    static void bishopExpression();
+
+    static void primitives();
+
+    static void negation();
+
+    static void transforms();
+
+    static void bounds();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHAlgorithms
+
+#endif // SHAPE_EXPRESSIONS_TEST_SUITE_H_1C8E4A2F6B0D4F3E9A7C5B1D3E8F0A62
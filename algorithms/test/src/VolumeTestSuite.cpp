@@ -16,6 +16,56 @@ void VolumeTestSuite::testDefaultCtor()
   ASSERT_NO_THROW({ Volume v; });
 }
 
+void VolumeTestSuite::testCuboidOperations()
+{
+  const Cuboid first(Point3D(0., 0., 0.), 2., 2., 2.);
+  const Cuboid second(Point3D(1., -1., 1.), 2., 2., 2.);
+
+  const Cuboid intersection = intersectCuboids(first, second);
+  EXPECT_EQ(Point3D(1., 0., 1.), intersection.startingPoint);
+  EXPECT_DOUBLE_EQ(1., intersection.width);
+  EXPECT_DOUBLE_EQ(1., intersection.length);
+  EXPECT_DOUBLE_EQ(1., intersection.height);
+
+  const Cuboid empty = intersectCuboids(first, Cuboid(Point3D(3., 0., 0.), 1., 1., 1.));
+  EXPECT_DOUBLE_EQ(0., empty.width);
+
+  const Cuboid unity = uniteCuboids(first, second);
+  EXPECT_EQ(Point3D(0., -1., 0.), unity.startingPoint);
+  EXPECT_DOUBLE_EQ(3., unity.width);
+  EXPECT_DOUBLE_EQ(3., unity.length);
+  EXPECT_DOUBLE_EQ(3., unity.height);
+
+  const Cuboid expanded = expandCuboid(first, 0.5);
+  EXPECT_EQ(Point3D(-0.5, -0.5, -0.5), expanded.startingPoint);
+  EXPECT_DOUBLE_EQ(3., expanded.width);
+}
+
+void VolumeTestSuite::testDomain()
+{
+  const Cuboid cube(Point3D(0., 0., 0.), 2., 2., 2.);
+
+  EXPECT_FALSE(Volume(cube).hasDomain());
+  EXPECT_TRUE(Volume(cube).intersectsDomain(Cuboid(Point3D(0., 0., 0.), 0.2, 0.2, 0.2)));
+
+  // the cylindrical tank with radius 1 along z axis
+  const Volume tank(cube,
+                    [](float x, float y, float) { return 1.f - (x - 1.f) * (x - 1.f) - (y - 1.f) * (y - 1.f); },
+                    0.05);
+  ASSERT_TRUE(tank.hasDomain());
+
+  EXPECT_NEAR(0.1, tank.getDomainDistance(Point3D(1.9, 1., 1.)), 1e-2);
+  EXPECT_GT(0.f, tank.getDomainDistance(Point3D(0.1, 0.1, 1.)));
+
+  const Point3D normal = tank.getDomainNormal(Point3D(1.9, 1., 1.));
+  EXPECT_NEAR(-1., normal.x, 1e-3);
+  EXPECT_NEAR(0., normal.y, 1e-3);
+
+  // the corner of the cube is outside of the tank
+  EXPECT_FALSE(tank.intersectsDomain(Cuboid(Point3D(0., 0., 0.), 0.2, 0.2, 0.2)));
+  EXPECT_TRUE(tank.intersectsDomain(Cuboid(Point3D(0.2, 0.8, 0.), 0.2, 0.2, 0.2)));
+}
+
 } // namespace SPHAlgorithms::TestEnvironment
 
 using namespace SPHAlgorithms::TestEnvironment;
@@ -23,4 +73,14 @@ using namespace SPHAlgorithms::TestEnvironment;
 TEST(VolumeTestSuite, testDefaultCtor)
 {
   VolumeTestSuite::testDefaultCtor();
+}
+
+TEST(VolumeTestSuite, testCuboidOperations)
+{
+  VolumeTestSuite::testCuboidOperations();
+}
+
+TEST(VolumeTestSuite, testDomain)
+{
+  VolumeTestSuite::testDomain();
 }
\ No newline at end of file
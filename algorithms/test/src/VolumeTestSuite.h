@@ -12,6 +12,10 @@ class VolumeTestSuite
 {
 public:
     static void testDefaultCtor();
+
+    static void testCuboidOperations();
+
+    static void testDomain();
 };
 
 } // SPHAlgorithms::TestEnvironment
@@ -25,6 +25,9 @@ static int height = 900;
 
 static float angle = 360;
 
+// the frame is redrawn by the timer, the simulation advances by the same time
+static const int FrameMilliseconds = 30;
+
 static SPHSDK::SPH sph;
 
 static SPHAlgorithms::Point3FVector mesh;
@@ -120,11 +123,18 @@ void MyDisplay(void)
     gluLookAt(7.0, 8.0, 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0);
     glRotatef(angle, -1, 0, 0);
 
-    sph.run();
+    sph.advance(FrameMilliseconds / 1000.);
 
     const float cubeSize = static_cast<float>(SPHSDK::Config::CubeSize);
 
-    // Draw the obstacle
+    // Draw the obstacle, the mesh is built once in the local space and placed by the obstacle transform.
+    // The const access does not mark the obstacles changed, so they are not indexed again
+    double obstacleMatrix[16];
+    static_cast<const SPHSDK::SPH&>(sph).getObstacle(0).getTransform().getMatrix(obstacleMatrix);
+
+    glPushMatrix();
+    glMultMatrixd(obstacleMatrix);
+
     glBegin(GL_TRIANGLES);
     for (const auto& triangle : mesh)
     {
@@ -133,6 +143,8 @@ void MyDisplay(void)
     }
     glEnd();
 
+    glPopMatrix();
+
     for (auto& particle : sph.particles)
     {
         renderSphere_convenient(static_cast<float>(particle.position.x), static_cast<float>(particle.position.y),
@@ -209,7 +221,7 @@ void timf(int /*value*/)
     glutPostRedisplay();
 
     // setup next timer
-    glutTimerFunc(30, timf, 0);
+    glutTimerFunc(FrameMilliseconds, timf, 0);
 }
 
 void processNormalKeys(unsigned char key, int /*x*/, int /*y*/)
@@ -255,10 +267,10 @@ void processSpecialKeys(int key, int /*xx*/, int /*yy*/)
 
 void Draw::MainDraw(int argc, char** argv)
 {
-    static const std::function<float(float, float, float)> obstacle = SPHAlgorithms::Shapes::Pawn;
-    sph = SPHSDK::SPH(&obstacle);
+    const auto obstacle = SPHAlgorithms::Shapes::PawnExpression();
+    sph = SPHSDK::SPH(SPHSDK::Obstacle(obstacle), true);
 
-    mesh = SPHAlgorithms::MarchingCubes::generateMesh(obstacle);
+    mesh = SPHAlgorithms::MarchingCubes::generateMeshAdaptive(obstacle);
 
     // GLUT initialization
     glutInit(&argc, argv);
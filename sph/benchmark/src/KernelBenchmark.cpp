@@ -0,0 +1,65 @@
+/**
+ * @file KernelBenchmark.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "sph/src/Forces.h"
+
+#include "algorithms/src/Area.h"
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+using namespace SPHSDK;
+
+// The block of 16^3 particles with about 60 neighbours per particle
+template <class Scalar> ParticleVectT<Scalar> createBlock()
+{
+    ParticleVectT<Scalar> particles;
+
+    for (size_t i = 0u; i < 16u; ++i)
+        for (size_t j = 0u; j < 16u; ++j)
+            for (size_t k = 0u; k < 16u; ++k)
+                particles.push_back(ParticleT<Scalar>(SPHAlgorithms::Point3<Scalar>(
+                    static_cast<Scalar>(0.2 + 0.04 * i), static_cast<Scalar>(0.2 + 0.04 * j),
+                    static_cast<Scalar>(0.2 + 0.04 * k))));
+
+    return particles;
+}
+
+// Computes all the forces with the kernel policy, the items are the neighbour pairs
+template <class Scalar, class Kernel> void BM_Forces(benchmark::State& state)
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+
+    ParticleVectT<Scalar> particles = createBlock<Scalar>();
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVectT<Scalar>> searcher(volume, Config::WaterSupportRadius, 0.001);
+    searcher.search(particles);
+
+    size_t pairsNumber = 0u;
+    for (const auto& particle : particles)
+        pairsNumber += particle.neighbours.size();
+
+    for (auto _ : state)
+    {
+        ForcesT<Scalar, Kernel>::ComputeAllForces(particles);
+        benchmark::DoNotOptimize(particles.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pairsNumber));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Forces, double, MullerKernel<double>);
+BENCHMARK_TEMPLATE(BM_Forces, double, TabulatedMullerKernel<double>);
+BENCHMARK_TEMPLATE(BM_Forces, double, CubicSplineKernel<double>);
+BENCHMARK_TEMPLATE(BM_Forces, double, WendlandC2Kernel<double>);
+BENCHMARK_TEMPLATE(BM_Forces, double, WendlandC4Kernel<double>);
+BENCHMARK_TEMPLATE(BM_Forces, float, MullerKernel<float>);
+BENCHMARK_TEMPLATE(BM_Forces, float, TabulatedMullerKernel<float>);
@@ -0,0 +1,101 @@
+/**
+ * @file ObstacleBenchmark.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "sph/src/Collisions.h"
+#include "sph/src/Obstacle.h"
+#include "sph/src/ObstacleIndex.h"
+
+#include "algorithms/src/Area.h"
+#include "algorithms/src/NeighboursSearch.h"
+#include "algorithms/src/ShapeExpressions.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+using namespace SPHSDK;
+using namespace SPHAlgorithms::ShapeExpressions;
+
+const double TankSize = 4.;
+const double SearchRadius = 0.1;
+
+// The particles fill the lower half of the tank
+ParticleVect createParticles()
+{
+    ParticleVect particles;
+
+    for (size_t i = 0u; i < 20u; ++i)
+        for (size_t j = 0u; j < 20u; ++j)
+            for (size_t k = 0u; k < 10u; ++k)
+            {
+                particles.push_back(
+                    Particle(SPHAlgorithms::Point3D(0.1 + 0.2 * i, 0.1 + 0.2 * j, 0.1 + 0.2 * k), 0.01));
+                particles.back().previous_position = particles.back().position;
+            }
+
+    return particles;
+}
+
+// Places the obstacles on the lattice at the height, eight obstacles per row
+std::vector<Obstacle> createObstacles(size_t number, float height)
+{
+    std::vector<Obstacle> obstacles;
+
+    for (size_t i = 0u; i < number; ++i)
+    {
+        const float x = 0.25f + 0.5f * static_cast<float>(i % 8u);
+        const float y = 0.25f + 0.5f * static_cast<float>((i / 8u) % 8u);
+        obstacles.push_back(Obstacle(Sphere(SPHAlgorithms::Point3F(x, y, height), 0.15f)));
+    }
+
+    return obstacles;
+}
+
+void runCollisions(benchmark::State& state, const std::vector<Obstacle>& obstacles)
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), TankSize, TankSize, TankSize));
+
+    ParticleVect particles = createParticles();
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, SearchRadius, 0.001);
+    searcher.search(particles);
+
+    std::vector<SPHAlgorithms::Cuboid> obstacleBounds;
+    for (const Obstacle& obstacle : obstacles)
+        obstacleBounds.push_back(obstacle.getBoundingCuboid());
+
+    const ObstacleIndex index(searcher, obstacleBounds, 0.01);
+
+    for (auto _ : state)
+    {
+        Collision::detectCollisions(particles, volume, obstacles, index.findCandidates(searcher));
+        benchmark::DoNotOptimize(particles.data());
+    }
+
+    state.counters["obstacles"] = static_cast<double>(obstacles.size());
+}
+
+// A fixed group of obstacles in the fluid and the growing amount of obstacles above it
+void BM_DistantObstacles(benchmark::State& state)
+{
+    std::vector<Obstacle> obstacles = createObstacles(8u, 1.f);
+    const std::vector<Obstacle> distant = createObstacles(static_cast<size_t>(state.range(0)), 3.5f);
+    obstacles.insert(obstacles.end(), distant.begin(), distant.end());
+
+    runCollisions(state, obstacles);
+}
+
+// The growing amount of obstacles in the fluid
+void BM_LocalObstacles(benchmark::State& state)
+{
+    runCollisions(state, createObstacles(8u + static_cast<size_t>(state.range(0)), 1.f));
+}
+
+} // namespace
+
+BENCHMARK(BM_DistantObstacles)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
+BENCHMARK(BM_LocalObstacles)->Arg(8)->Arg(32)->Arg(128)->Arg(512);
@@ -0,0 +1,116 @@
+/**
+ * @file SolverBenchmark.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "sph/src/DivergenceFreeSolver.h"
+#include "sph/src/MultipleTimeStepSolver.h"
+#include "sph/src/PredictiveCorrectiveSolver.h"
+#include "sph/src/SPH.h"
+#include "sph/src/Scene.h"
+#include "sph/src/Solver.h"
+#include "sph/src/WeaklyCompressibleSolver.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace
+{
+
+using namespace SPHSDK;
+
+// The simulated time of the dam break, the column reaches the opposite wall of the cube before it
+const double SimulatedTime = 0.5;
+
+std::unique_ptr<Solver> createExplicitSolver()
+{
+    return std::unique_ptr<Solver>(new ExplicitSolver());
+}
+
+template <class Scheme> std::unique_ptr<Solver> createExplicitSolverWithScheme()
+{
+    return std::unique_ptr<Solver>(new ExplicitSolverT<Scheme>());
+}
+
+std::unique_ptr<Solver> createWeaklyCompressibleSolver()
+{
+    return std::unique_ptr<Solver>(new WeaklyCompressibleSolver());
+}
+
+std::unique_ptr<Solver> createWeaklyCompressibleSolverWithoutDiffusion()
+{
+    return std::unique_ptr<Solver>(new WeaklyCompressibleSolver(false));
+}
+
+std::unique_ptr<Solver> createMultipleTimeStepSolver()
+{
+    return std::unique_ptr<Solver>(new MultipleTimeStepSolver());
+}
+
+std::unique_ptr<Solver> createPredictiveCorrectiveSolver()
+{
+    return std::unique_ptr<Solver>(new PredictiveCorrectiveSolver());
+}
+
+std::unique_ptr<Solver> createDivergenceFreeSolver()
+{
+    return std::unique_ptr<Solver>(new DivergenceFreeSolver());
+}
+
+// The honey-like fluid, the explicit viscosity would need the steps a few hundred times shorter
+std::unique_ptr<Solver> createDivergenceFreeSolverWithImplicitViscosity()
+{
+    std::unique_ptr<DivergenceFreeSolver> solver(new DivergenceFreeSolver());
+    solver->setImplicitViscosity(1000. * Config::WaterViscosity);
+
+    return std::unique_ptr<Solver>(solver.release());
+}
+
+// The water column in the corner of the tank collapses, the wall time is measured to the fixed simulated time
+void BM_DamBreak(benchmark::State& state, std::unique_ptr<Solver> (*createSolver)())
+{
+    size_t stepsNumber = 0u;
+    size_t particlesNumber = 0u;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        SPH sph;
+        sph.particles = Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 0.4, 0.4, 0.4));
+        sph.setSolver(createSolver());
+        particlesNumber = sph.particles.size();
+        stepsNumber = 0u;
+        state.ResumeTiming();
+
+        while (sph.getTime() < SimulatedTime)
+        {
+            sph.run();
+            stepsNumber++;
+        }
+
+        benchmark::DoNotOptimize(sph.particles.data());
+    }
+
+    state.counters["particles"] = static_cast<double>(particlesNumber);
+    state.counters["steps"] = static_cast<double>(stepsNumber);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_DamBreak, Explicit, &createExplicitSolver)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, ExplicitLeapfrog, &createExplicitSolverWithScheme<LeapfrogScheme>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, ExplicitSymplecticEuler, &createExplicitSolverWithScheme<SymplecticEulerScheme>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, ExplicitMidpoint, &createExplicitSolverWithScheme<MidpointScheme>)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, WeaklyCompressible, &createWeaklyCompressibleSolver)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, WeaklyCompressibleWithoutDiffusion, &createWeaklyCompressibleSolverWithoutDiffusion)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, MultipleTimeStep, &createMultipleTimeStepSolver)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, PredictiveCorrective, &createPredictiveCorrectiveSolver)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, DivergenceFree, &createDivergenceFreeSolver)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DamBreak, DivergenceFreeImplicitViscosity, &createDivergenceFreeSolverWithImplicitViscosity)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,165 @@
+/**
+ * @file Boundary.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Boundary.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPHSDK
+{
+
+namespace
+{
+/**
+ * @brief Samples the lattice of the cuboid with the step not longer than the spacing. The solid lattice point is
+ * the boundary particle if some of its six nearby points is not solid, the lattice point on the faces of
+ * the cuboid is the boundary particle if it is not solid and the faces are sampled. The faces of the periodic
+ * axes are open, the lattice along them skips the end face, which is the image of the start one.
+ */
+template <class IsSolid>
+void sampleSurface(const SPHAlgorithms::Cuboid&      cuboid,
+                   double                            spacing,
+                   bool                              sampleFaces,
+                   const SPHAlgorithms::Periodicity& periodicity,
+                   const IsSolid&                    isSolid,
+                   BoundaryParticleVect&             particles)
+{
+    const double sizes[3] = {cuboid.width, cuboid.length, cuboid.height};
+
+    size_t pointsNumber[3];
+    double steps[3];
+
+    for (size_t axis = 0u; axis < 3u; ++axis)
+    {
+        const size_t stepsNumber = std::max<size_t>(static_cast<size_t>(std::ceil(sizes[axis] / spacing)), 1u);
+
+        pointsNumber[axis] = periodicity.isPeriodic(axis) ? stepsNumber : stepsNumber + 1u;
+        steps[axis] = sizes[axis] / static_cast<double>(stepsNumber);
+    }
+
+    const auto getPoint = [&](size_t x, size_t y, size_t z) {
+        return cuboid.startingPoint + SPHAlgorithms::Point3D(x * steps[0], y * steps[1], z * steps[2]);
+    };
+
+    for (size_t z = 0; z < pointsNumber[2]; z++)
+        for (size_t y = 0; y < pointsNumber[1]; y++)
+            for (size_t x = 0; x < pointsNumber[0]; x++)
+            {
+                const SPHAlgorithms::Point3D point = getPoint(x, y, z);
+
+                const size_t indexes[3] = {x, y, z};
+
+                bool isOnFace = false;
+
+                for (size_t axis = 0u; axis < 3u; ++axis)
+                {
+                    isOnFace = isOnFace || (!periodicity.isPeriodic(axis) &&
+                                            (indexes[axis] == 0u || indexes[axis] + 1u == pointsNumber[axis]));
+                }
+
+                if (!isSolid(point))
+                {
+                    if (sampleFaces && isOnFace)
+                        particles.emplace_back(point);
+
+                    continue;
+                }
+
+                // the solid point on the face of the closed axis is the surface, so only the nearby points along
+                // the periodic axes leave the lattice, they are wrapped to the opposite face
+                bool isSurface = isOnFace;
+
+                for (size_t axis = 0u; !isSurface && axis < 3u; ++axis)
+                {
+                    size_t previousIndexes[3] = {x, y, z};
+                    size_t nextIndexes[3] = {x, y, z};
+
+                    previousIndexes[axis] = indexes[axis] == 0u ? pointsNumber[axis] - 1u : indexes[axis] - 1u;
+                    nextIndexes[axis] = indexes[axis] + 1u == pointsNumber[axis] ? 0u : indexes[axis] + 1u;
+
+                    isSurface = !isSolid(getPoint(previousIndexes[0], previousIndexes[1], previousIndexes[2])) ||
+                                !isSolid(getPoint(nextIndexes[0], nextIndexes[1], nextIndexes[2]));
+                }
+
+                if (isSurface)
+                    particles.emplace_back(point);
+            }
+}
+} // namespace
+
+Boundary::Boundary(const SPHAlgorithms::Volume&      volume,
+                   const std::vector<Obstacle>&      obstacles,
+                   double                            spacing,
+                   double                            supportRadius,
+                   const SPHAlgorithms::Periodicity& periodicity)
+    : m_supportRadius(supportRadius)
+    , m_cuboid(volume.getBoundingCuboid())
+    , m_periodicity(periodicity)
+{
+    if (volume.hasDomain())
+    {
+        sampleSurface(m_cuboid,
+                      spacing,
+                      true,
+                      m_periodicity,
+                      [&volume](const SPHAlgorithms::Point3D& point) {
+                          return volume.getDomainDistance(point) <= 0.f;
+                      },
+                      m_particles);
+    }
+    else
+    {
+        sampleSurface(m_cuboid,
+                      spacing,
+                      true,
+                      m_periodicity,
+                      [](const SPHAlgorithms::Point3D& /*point*/) { return false; },
+                      m_particles);
+    }
+
+    for (const Obstacle& obstacle : obstacles)
+    {
+        // the margin keeps the outside points around the surface within the sampled cuboid
+        const SPHAlgorithms::Cuboid obstacleCuboid = SPHAlgorithms::intersectCuboids(
+            SPHAlgorithms::expandCuboid(obstacle.getBoundingCuboid(), spacing), m_cuboid);
+
+        sampleSurface(obstacleCuboid,
+                      spacing,
+                      false,
+                      SPHAlgorithms::Periodicity(),
+                      [&obstacle](const SPHAlgorithms::Point3D& point) {
+                          return obstacle(static_cast<float>(point.x),
+                                          static_cast<float>(point.y),
+                                          static_cast<float>(point.z)) > 0.f;
+                      },
+                      m_particles);
+    }
+
+    computeVolumes();
+}
+
+void Boundary::setStaticPoints(SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher) const
+{
+    searcher.setStaticPoints(m_particles);
+}
+
+void Boundary::findNeighbours(ParticleVect& particles, SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher)
+{
+    searcher.search(particles, m_neighbours);
+}
+
+const SPHAlgorithms::SizetVector& Boundary::getNeighbours(size_t particleIndex) const
+{
+    return m_neighbours[particleIndex];
+}
+
+const BoundaryParticleVect& Boundary::getParticles() const
+{
+    return m_particles;
+}
+
+} // namespace SPHSDK
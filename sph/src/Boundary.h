@@ -0,0 +1,141 @@
+/**
+ * @file Boundary.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef BOUNDARY_H_5C1E8B7A3D964F2E9A0B4C6D8E2F7A13
+#define BOUNDARY_H_5C1E8B7A3D964F2E9A0B4C6D8E2F7A13
+
+#include "Config.h"
+#include "Kernels.h"
+#include "Obstacle.h"
+#include "Particle.h"
+
+#include "algorithms/src/Area.h"
+#include "algorithms/src/Defines.h"
+#include "algorithms/src/NeighboursSearch.h"
+#include "algorithms/src/Periodicity.h"
+#include "algorithms/src/Point.h"
+
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class BoundaryTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief BoundaryParticle is the frozen particle of the wall, it only has the position and the volume.
+ */
+struct BoundaryParticle
+{
+    BoundaryParticle() = default;
+
+    explicit BoundaryParticle(const SPHAlgorithms::Point3D& boundaryPosition)
+        : position(boundaryPosition)
+    {
+    }
+
+    SPHAlgorithms::Point3D position;
+
+    double volume = 0.;
+
+    SPHAlgorithms::SizetVector neighbours; // only used by the search of the volumes
+};
+
+using BoundaryParticleVect = std::vector<BoundaryParticle>;
+
+/**
+ * @brief Boundary class samples the walls of the volume and the obstacles by the frozen boundary particles
+ * (Akinci et al. 2012), so the fluid particles near the walls have complete kernels. The boundary particle acts
+ * as the fluid of the rest density with its volume V_b = 1 / sum_k W_bk over the boundary particles, so the
+ * unevenly sampled walls do not push harder where the particles are denser:
+ * - the density rho_i += rho0 * V_b * W_ib;
+ * - the pressure force mirrors the pressure of the fluid particle;
+ * - the viscosity force is the friction with the wall at rest.
+ * The particles never move, so they are the static points of the neighbours search of the fluid: they are put
+ * into the boxes once and the fluid particles find them together with their fluid neighbours.
+ */
+class Boundary
+{
+    friend class TestEnvironment::BoundaryTestSuite;
+
+public:
+    /**
+     * @brief Samples the faces of the volume cuboid, or the border of the domain if the volume has it, and
+     * the surfaces of the obstacles inside of the cuboid in their current placement.
+     * @param spacing          The distance between the boundary particles
+     * @param supportRadius    The support radius of the kernels of the fluid and the boundary particles
+     * @param periodicity      The faces of the periodic axes are open, they are not sampled
+     */
+    Boundary(const SPHAlgorithms::Volume&      volume,
+             const std::vector<Obstacle>&      obstacles,
+             double                            spacing,
+             double                            supportRadius = Config::WaterSupportRadius,
+             const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Sets the boundary particles as the static points of the searcher of the fluid neighbours.
+     */
+    void setStaticPoints(SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher) const;
+
+    /**
+     * @brief Searches the fluid neighbours and the boundary neighbours of every fluid particle by the searcher
+     * with the boundary particles set as its static points.
+     */
+    void findNeighbours(ParticleVect& particles, SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher);
+
+    /**
+     * @brief Returns the boundary particles found near the fluid particle by the last findNeighbours().
+     */
+    const SPHAlgorithms::SizetVector& getNeighbours(size_t particleIndex) const;
+
+    const BoundaryParticleVect& getParticles() const;
+
+    /**
+     * @brief Computes the volumes of the boundary particles by the kernel policy of Kernels.h, the solver sets
+     * them for its kernel. The constructor computes them by MullerKernel.
+     */
+    template <class Kernel = MullerKernel<double>> void computeVolumes();
+
+    /**
+     * @brief Adds the density of the boundary neighbours to the densities of the fluid particles.
+     */
+    template <class Kernel = MullerKernel<double>> void addDensity(ParticleVect& particles) const;
+
+    /**
+     * @brief Returns the boundary term of the continuity equation of the fluid particle, the walls are at rest.
+     */
+    template <class Kernel = MullerKernel<double>>
+    double calcDensityRate(const ParticleVect& particles, size_t i) const;
+
+    /**
+     * @brief Adds the pressure and the viscosity forces of the boundary neighbours to the internal and
+     * the total forces of the fluid particles.
+     */
+    template <class Kernel = MullerKernel<double>> void addForces(ParticleVect& particles) const;
+
+    template <class Kernel = MullerKernel<double>> void addForces(ParticleVect& particles, size_t i) const;
+
+private:
+
+    double m_supportRadius;
+
+    SPHAlgorithms::Cuboid m_cuboid;
+
+    SPHAlgorithms::Periodicity m_periodicity;
+
+    BoundaryParticleVect m_particles;
+
+    SPHAlgorithms::VectorOfSizetVectors m_neighbours; // the boundary neighbours of every fluid particle
+};
+
+} // namespace SPHSDK
+
+#include "Boundary.hpp"
+
+#endif // BOUNDARY_H_5C1E8B7A3D964F2E9A0B4C6D8E2F7A13
@@ -0,0 +1,132 @@
+/**
+ * @file Boundary.hpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include <algorithm>
+
+namespace SPHSDK
+{
+
+template <class Kernel> void Boundary::computeVolumes()
+{
+    // the boundary particles are only searched for the volumes, all the boxes of the cuboid are searched even with
+    // the domain
+    SPHAlgorithms::NeighboursSearch3D<BoundaryParticleVect> searcher(
+        SPHAlgorithms::Volume(m_cuboid), m_supportRadius, 0.001);
+    searcher.setPeriodicity(m_periodicity);
+    searcher.search(m_particles);
+
+    const double supportRadiusSqr = m_supportRadius * m_supportRadius;
+
+    for (BoundaryParticle& particle : m_particles)
+    {
+        double kernelSum = Kernel::value(0., m_supportRadius);
+
+        for (const size_t neighbourIndex : particle.neighbours)
+        {
+            const double distanceSqr =
+                m_periodicity.calcMinimumImage(particle.position - m_particles[neighbourIndex].position).calcNormSqr();
+
+            if (distanceSqr < supportRadiusSqr)
+                kernelSum += Kernel::value(distanceSqr, m_supportRadius);
+        }
+
+        particle.volume = 1. / kernelSum;
+
+        // the boundary particles do not need their neighbours anymore
+        SPHAlgorithms::SizetVector().swap(particle.neighbours);
+    }
+}
+
+template <class Kernel> void Boundary::addDensity(ParticleVect& particles) const
+{
+    const double supportRadiusSqr = m_supportRadius * m_supportRadius;
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        for (const size_t boundaryIndex : m_neighbours[i])
+        {
+            const SPHAlgorithms::Point3D difference =
+                m_periodicity.calcMinimumImage(particles[i].position - m_particles[boundaryIndex].position);
+            const double distanceSqr = difference.calcNormSqr();
+
+            if (distanceSqr < supportRadiusSqr)
+                particles[i].density += Config::WaterDensity * m_particles[boundaryIndex].volume *
+                                        Kernel::value(distanceSqr, m_supportRadius);
+        }
+    }
+}
+
+template <class Kernel> double Boundary::calcDensityRate(const ParticleVect& particles, size_t i) const
+{
+    const double supportRadiusSqr = m_supportRadius * m_supportRadius;
+
+    double densityRate = 0.;
+
+    for (const size_t boundaryIndex : m_neighbours[i])
+    {
+        const SPHAlgorithms::Point3D difference =
+            m_periodicity.calcMinimumImage(particles[i].position - m_particles[boundaryIndex].position);
+        const double distanceSqr = difference.calcNormSqr();
+
+        if (distanceSqr <= 0. || distanceSqr >= supportRadiusSqr)
+            continue;
+
+        const SPHAlgorithms::Point3D gradient = Kernel::pressureGradient(difference, m_supportRadius);
+
+        densityRate += Config::WaterDensity * m_particles[boundaryIndex].volume *
+                       SPHAlgorithms::calcDotProduct(particles[i].velocity, gradient);
+    }
+
+    return densityRate;
+}
+
+template <class Kernel> void Boundary::addForces(ParticleVect& particles) const
+{
+    for (size_t i = 0; i < particles.size(); i++)
+        addForces<Kernel>(particles, i);
+}
+
+template <class Kernel> void Boundary::addForces(ParticleVect& particles, size_t i) const
+{
+    const double supportRadiusSqr = m_supportRadius * m_supportRadius;
+
+    Particle& particle = particles[i];
+
+    // the negative pressure would pull the particles to the walls
+    const double pressure = std::max(0., particle.pressure);
+
+    SPHAlgorithms::Point3D fPressure;
+    SPHAlgorithms::Point3D fViscosity;
+
+    for (const size_t boundaryIndex : m_neighbours[i])
+    {
+        const SPHAlgorithms::Point3D difference =
+            m_periodicity.calcMinimumImage(particle.position - m_particles[boundaryIndex].position);
+        const double distanceSqr = difference.calcNormSqr();
+
+        if (distanceSqr <= 0. || distanceSqr >= supportRadiusSqr)
+            continue;
+
+        const double mass = Config::WaterDensity * m_particles[boundaryIndex].volume;
+
+        // the pressure and the density of the boundary particle are the ones of the fluid particle, so the term
+        // (p_i + p_b) * m_b / rho_b of Formula 4.14 is 2 * p_i * m_b / rho_i
+        fPressure += Kernel::pressureGradient(difference, m_supportRadius) *
+                     (-pressure * mass / particle.density);
+
+        fViscosity += particle.velocity * (-Kernel::viscosityLaplacian(distanceSqr, m_supportRadius) *
+                                           mass / particle.density);
+    }
+
+    fViscosity *= Config::WaterViscosity;
+
+    particle.fPressure += fPressure;
+    particle.fViscosity += fViscosity;
+    particle.fInternal += fPressure + fViscosity;
+    particle.fTotal += fPressure + fViscosity;
+}
+
+} // namespace SPHSDK
@@ -1,7 +1,9 @@
 #include "Collisions.h"
 
 #include "Config.h"
+#include "Obstacle.h"
 #include "algorithms/src/Area.h"
+#include "algorithms/src/DistanceField.h"
 
 
 namespace SPHSDK
@@ -38,81 +40,247 @@ static SPHAlgorithms::Point3D calculateVelocity(const SPHAlgorithms::Point3D& pa
     return particleVelocity - differenceParticleNeighbour * 2 * scalarProduct;
 }
 
+// (Formulae 4.35, 4.55 & 4.56)
+void Collision::detectParticleCollisions(ParticleVect&                     particleVect,
+                                         size_t                            i,
+                                         const SPHAlgorithms::Periodicity& periodicity)
+{
+    for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
+    {
+        SPHAlgorithms::Point3D differenceParticleNeighbour =
+            calcDifference(particleVect[i], particleVect[particleVect[i].neighbours[j]], periodicity);
+
+        // (Formula 4.35)
+        if (calculateF(differenceParticleNeighbour) < 0)
+        {
+            const SPHAlgorithms::Point3D surfaceNormal = calculateSurfaceNormal(differenceParticleNeighbour);
+
+            // (Formula 4.55)
+            particleVect[i].position = calculateContactPoint(particleVect[i].position, differenceParticleNeighbour);
+
+            // (Formula 4.56)
+            particleVect[i].velocity = calculateVelocity(particleVect[i].velocity, surfaceNormal);
+        }
+    }
+}
+
+// the particle is put back at its radius from the face and its velocity along the axis is reflected
+static void reflectFromFaces(double& position, double& velocity, double start, double end, double radius)
+{
+    if (position > end - radius)
+    {
+        position = end - radius;
+        velocity *= Config::CollisionVelocityMultiplier;
+    }
+
+    if (position < start + radius)
+    {
+        position = start + radius;
+        velocity *= Config::CollisionVelocityMultiplier;
+    }
+}
+
+void Collision::detectBoundaryCollision(Particle&                         particle,
+                                        const SPHAlgorithms::Cuboid&      cuboid,
+                                        const SPHAlgorithms::Periodicity& periodicity)
+{
+    // the particle leaving through the face of the periodic axis enters through the opposite one, the previous
+    // position is moved along for the integrators and the obstacles
+    if (periodicity.hasPeriodicAxes())
+    {
+        const SPHAlgorithms::Point3D shift = periodicity.wrap(particle.position) - particle.position;
+
+        particle.position += shift;
+        particle.previous_position += shift;
+    }
+
+    const SPHAlgorithms::Point3D start = cuboid.startingPoint;
+    const SPHAlgorithms::Point3D end = start + SPHAlgorithms::Point3D(cuboid.width, cuboid.length, cuboid.height);
+
+    if (!periodicity.isPeriodic(0u))
+        reflectFromFaces(particle.position.x, particle.velocity.x, start.x, end.x, particle.radius);
+
+    if (!periodicity.isPeriodic(1u))
+        reflectFromFaces(particle.position.y, particle.velocity.y, start.y, end.y, particle.radius);
+
+    if (!periodicity.isPeriodic(2u))
+        reflectFromFaces(particle.position.z, particle.velocity.z, start.z, end.z, particle.radius);
+}
+
+void Collision::detectDomainCollision(Particle& particle, const SPHAlgorithms::Volume& volume)
+{
+    if (!volume.hasDomain())
+        return;
+
+    // the distance is positive inside the domain
+    const double penetration = particle.radius - volume.getDomainDistance(particle.position);
+
+    if (penetration > 0.)
+    {
+        const SPHAlgorithms::Point3D surfaceNormal = volume.getDomainNormal(particle.position);
+
+        particle.position += surfaceNormal * penetration;
+
+        const double normalVelocity = particle.velocity.x * surfaceNormal.x +
+                                      particle.velocity.y * surfaceNormal.y +
+                                      particle.velocity.z * surfaceNormal.z;
+
+        if (normalVelocity < 0.)
+            particle.velocity += surfaceNormal * normalVelocity * (Config::CollisionVelocityMultiplier - 1.);
+    }
+}
+
 void Collision::detectCollisions(ParticleVect&                                    particleVect,
                                  const SPHAlgorithms::Volume&                     volume,
-                                 const std::function<float(float, float, float)>* obstacle)
+                                 const std::function<float(float, float, float)>* obstacle,
+                                 const SPHAlgorithms::Periodicity&                periodicity)
+{
+    if (obstacle != nullptr)
+        detectCollisions(particleVect, volume, *obstacle, periodicity);
+    else
+        detectCollisions(particleVect, volume, [](float, float, float) { return -1.f; }, periodicity);
+}
+
+void Collision::detectCollisions(ParticleVect&                       particleVect,
+                                 const SPHAlgorithms::Volume&        volume,
+                                 const SPHAlgorithms::DistanceField& obstacleField,
+                                 const SPHAlgorithms::Periodicity&   periodicity)
 {
+    const SPHAlgorithms::Cuboid cuboid = volume.getBoundingCuboid();
+
     for (size_t i = 0; i < particleVect.size(); i++)
     {
-        /* Particle Collision */
+        detectParticleCollisions(particleVect, i, periodicity);
 
-        for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
-        {
-            SPHAlgorithms::Point3D differenceParticleNeighbour =
-                particleVect[i].position - particleVect[particleVect[i].neighbours[j]].position;
+        detectBoundaryCollision(particleVect[i], cuboid, periodicity);
 
-            // (Formula 4.35)
-            if (calculateF(differenceParticleNeighbour) < 0)
-            {
-                const SPHAlgorithms::Point3D surfaceNormal = calculateSurfaceNormal(differenceParticleNeighbour);
+        detectDomainCollision(particleVect[i], volume);
 
-                // (Formula 4.55)
-                particleVect[i].position = calculateContactPoint(particleVect[i].position, differenceParticleNeighbour);
+        detectObstacleCollision(particleVect[i], obstacleField);
+    }
+}
 
-                // (Formula 4.56)
-                particleVect[i].velocity = calculateVelocity(particleVect[i].velocity, surfaceNormal);
-            }
-        }
+void Collision::detectCollisions(ParticleVect&                       particleVect,
+                                 const SPHAlgorithms::Volume&        volume,
+                                 const SPHAlgorithms::DistanceField& obstacleField,
+                                 const SPHAlgorithms::SizetVector&   obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&   periodicity)
+{
+    detectParticleAndBoundaryCollisions(particleVect, volume, periodicity);
 
-        /* Boundary Collision */
+    for (size_t i = 0; i < obstacleCandidates.size(); i++)
+        detectObstacleCollision(particleVect[obstacleCandidates[i]], obstacleField);
+}
 
-        const SPHAlgorithms::Cuboid cuboid = volume.getBoundingCuboid();
+void Collision::detectCollisions(ParticleVect&                              particleVect,
+                                 const SPHAlgorithms::Volume&               volume,
+                                 const std::vector<Obstacle>&               obstacles,
+                                 const SPHAlgorithms::VectorOfSizetVectors& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&          periodicity)
+{
+    detectParticleAndBoundaryCollisions(particleVect, volume, periodicity);
 
-        if (particleVect[i].position.x > cuboid.width - particleVect[i].radius)
-        {
-            particleVect[i].position.x = cuboid.width - particleVect[i].radius;
-            particleVect[i].velocity.x *= Config::CollisionVelocityMultiplier;
-        }
+    for (size_t obstacleIndex = 0; obstacleIndex < obstacles.size(); obstacleIndex++)
+        for (size_t i = 0; i < obstacleCandidates[obstacleIndex].size(); i++)
+            detectObstacleCollision(particleVect[obstacleCandidates[obstacleIndex][i]], obstacles[obstacleIndex]);
+}
 
-        if (particleVect[i].position.x < particleVect[i].radius)
-        {
-            particleVect[i].position.x = particleVect[i].radius;
-            particleVect[i].velocity.x *= Config::CollisionVelocityMultiplier;
-        }
+void Collision::detectCollisions(ParticleVect&                                    particleVect,
+                                 const SPHAlgorithms::Volume&                     volume,
+                                 const std::vector<Obstacle>&                     obstacles,
+                                 const std::vector<SPHAlgorithms::DistanceField>& obstacleFields,
+                                 const SPHAlgorithms::VectorOfSizetVectors&       obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&                periodicity)
+{
+    detectParticleAndBoundaryCollisions(particleVect, volume, periodicity);
 
-        if (particleVect[i].position.y > cuboid.length - particleVect[i].radius)
-        {
-            particleVect[i].position.y = cuboid.length - particleVect[i].radius;
-            particleVect[i].velocity.y *= Config::CollisionVelocityMultiplier;
-        }
+    for (size_t fieldIndex = 0; fieldIndex < obstacleFields.size(); fieldIndex++)
+        for (size_t i = 0; i < obstacleCandidates[fieldIndex].size(); i++)
+            detectObstacleCollision(particleVect[obstacleCandidates[fieldIndex][i]], obstacles[fieldIndex],
+                                    obstacleFields[fieldIndex]);
+}
 
-        if (particleVect[i].position.y < particleVect[i].radius)
-        {
-            particleVect[i].position.y = particleVect[i].radius;
-            particleVect[i].velocity.y *= Config::CollisionVelocityMultiplier;
-        }
+void Collision::detectParticleAndBoundaryCollisions(ParticleVect&                     particleVect,
+                                                    const SPHAlgorithms::Volume&      volume,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
+{
+    const SPHAlgorithms::Cuboid cuboid = volume.getBoundingCuboid();
 
-        if (particleVect[i].position.z > cuboid.height - particleVect[i].radius)
-        {
-            particleVect[i].position.z = cuboid.height - particleVect[i].radius;
-            particleVect[i].velocity.z *= Config::CollisionVelocityMultiplier;
-        }
+    for (size_t i = 0; i < particleVect.size(); i++)
+    {
+        detectParticleCollisions(particleVect, i, periodicity);
 
-        if (particleVect[i].position.z < particleVect[i].radius)
-        {
-            particleVect[i].position.z = particleVect[i].radius;
-            particleVect[i].velocity.z *= Config::CollisionVelocityMultiplier;
-        }
+        detectBoundaryCollision(particleVect[i], cuboid, periodicity);
 
-        /* Obstacle collision */
+        detectDomainCollision(particleVect[i], volume);
+    }
+}
 
-        if (obstacle != nullptr &&
-            (*obstacle)(static_cast<float>(particleVect[i].position.x), static_cast<float>(particleVect[i].position.y),
-                        static_cast<float>(particleVect[i].position.z)) > 0.f)
-        {
-            particleVect[i].position = particleVect[i].previous_position;
-            particleVect[i].velocity *= Config::CollisionVelocityMultiplier;
-        }
+void Collision::detectObstacleCollision(Particle& particle, const SPHAlgorithms::DistanceField& obstacleField)
+{
+    const SPHAlgorithms::Point3F position(static_cast<float>(particle.position.x),
+                                          static_cast<float>(particle.position.y),
+                                          static_cast<float>(particle.position.z));
+
+    // the distance is positive inside the obstacle
+    const double penetration = obstacleField.value(position) + particle.radius;
+
+    if (penetration > 0.)
+    {
+        const SPHAlgorithms::Point3F gradient = obstacleField.gradient(position);
+        const SPHAlgorithms::Point3D surfaceNormal(-gradient.x, -gradient.y, -gradient.z);
+
+        particle.position += surfaceNormal * penetration;
+
+        const double normalVelocity = particle.velocity.x * surfaceNormal.x +
+                                      particle.velocity.y * surfaceNormal.y +
+                                      particle.velocity.z * surfaceNormal.z;
+
+        if (normalVelocity < 0.)
+            particle.velocity += surfaceNormal * normalVelocity * (Config::CollisionVelocityMultiplier - 1.);
+    }
+}
+
+void Collision::detectObstacleCollision(Particle& particle, const Obstacle& obstacle)
+{
+    if (obstacle.evaluateLocal(obstacle.getTransform().toLocal(particle.position)) > 0.f)
+    {
+        // the velocity is reflected relative to the obstacle surface
+        const SPHAlgorithms::Point3D obstacleVelocity = obstacle.getVelocity(particle.position);
+
+        particle.position = particle.previous_position;
+        particle.velocity =
+            obstacleVelocity + (particle.velocity - obstacleVelocity) * Config::CollisionVelocityMultiplier;
+    }
+}
+
+void Collision::detectObstacleCollision(Particle&                           particle,
+                                        const Obstacle&                     obstacle,
+                                        const SPHAlgorithms::DistanceField& obstacleField)
+{
+    const SPHAlgorithms::Point3D localPoint = obstacle.getTransform().toLocal(particle.position);
+    const SPHAlgorithms::Point3F localPosition(static_cast<float>(localPoint.x), static_cast<float>(localPoint.y),
+                                               static_cast<float>(localPoint.z));
+
+    // the distance is positive inside the obstacle
+    const double penetration = obstacleField.value(localPosition) + particle.radius;
+
+    if (penetration > 0.)
+    {
+        const SPHAlgorithms::Point3F gradient = obstacleField.gradient(localPosition);
+        const SPHAlgorithms::Point3D surfaceNormal =
+            obstacle.getTransform().rotate(SPHAlgorithms::Point3D(-gradient.x, -gradient.y, -gradient.z));
+
+        particle.position += surfaceNormal * penetration;
+
+        // only the particles approaching the moving surface are reflected
+        const SPHAlgorithms::Point3D relativeVelocity = particle.velocity - obstacle.getVelocity(particle.position);
+
+        const double normalVelocity = relativeVelocity.x * surfaceNormal.x + relativeVelocity.y * surfaceNormal.y +
+                                      relativeVelocity.z * surfaceNormal.z;
+
+        if (normalVelocity < 0.)
+            particle.velocity += surfaceNormal * normalVelocity * (Config::CollisionVelocityMultiplier - 1.);
     }
 }
 } // namespace SPHSDK
@@ -11,25 +11,145 @@
 #include "algorithms/src/Defines.h"
 
 #include <functional>
+#include <type_traits>
+#include <vector>
 
 namespace SPHAlgorithms
 {
 class Area;
+struct Cuboid;
 class Volume;
+class DistanceField;
 } // namespace SPHAlgorithms
 
 namespace SPHSDK
 {
 
+class Obstacle;
+
 class Collision
 {
 
 public:
+    /**
+     * @brief Detects the collisions of the particles with each other, the walls of the volume and the obstacle.
+     * The particles crossing the faces of the periodic axes are wrapped to the opposite faces instead of being
+     * reflected, and the neighbours across them are taken at their nearest images. The other overloads take
+     * the periodicity the same way.
+     */
+    static void detectCollisions(ParticleVect&                                    particleVect,
+                                 const SPHAlgorithms::Volume&                     volume,
+                                 const std::function<float(float, float, float)>* obstacle = nullptr,
+                                 const SPHAlgorithms::Periodicity&                periodicity =
+                                     SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions using the cached obstacle field.
+     * Particles penetrating the obstacle are pushed out along the surface normal and the normal component
+     * of their velocity is reflected.
+     */
+    static void detectCollisions(ParticleVect&                       particleVect,
+                                 const SPHAlgorithms::Volume&        volume,
+                                 const SPHAlgorithms::DistanceField& obstacleField,
+                                 const SPHAlgorithms::Periodicity&   periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions with the obstacle given by any callable float(float, float, float), e.g. a shape
+     * expression. The obstacle type is a template parameter, so its equation is inlined into the particles loop.
+     */
+    template <class Equation,
+              class = std::enable_if_t<std::is_invocable_r_v<float, const Equation&, float, float, float>>>
+    static void detectCollisions(ParticleVect&                     particleVect,
+                                 const SPHAlgorithms::Volume&      volume,
+                                 const Equation&                   obstacle,
+                                 const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions testing the obstacle only for the candidates, the particles near its bounds.
+     * @param obstacleCandidates    The indexes of the particles which can hit the obstacle
+     */
+    template <class Equation,
+              class = std::enable_if_t<std::is_invocable_r_v<float, const Equation&, float, float, float>>>
+    static void detectCollisions(ParticleVect&                     particleVect,
+                                 const SPHAlgorithms::Volume&      volume,
+                                 const Equation&                   obstacle,
+                                 const SPHAlgorithms::SizetVector& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions using the cached obstacle field only for the candidates near the obstacle.
+     */
+    static void detectCollisions(ParticleVect&                       particleVect,
+                                 const SPHAlgorithms::Volume&        volume,
+                                 const SPHAlgorithms::DistanceField& obstacleField,
+                                 const SPHAlgorithms::SizetVector&   obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&   periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions with several obstacles, every obstacle is tested only for its own candidates.
+     * @param obstacleCandidates    The indexes of the particles near every obstacle
+     */
+    template <class Equation,
+              class = std::enable_if_t<std::is_invocable_r_v<float, const Equation&, float, float, float>>>
+    static void detectCollisions(ParticleVect&                              particleVect,
+                                 const SPHAlgorithms::Volume&               volume,
+                                 const std::vector<Equation>&               obstacles,
+                                 const SPHAlgorithms::VectorOfSizetVectors& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&          periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions with several placed obstacles. The particles are moved into the local space of
+     * the obstacle and the velocity of the obstacle surface is taken into account by the response.
+     */
+    static void detectCollisions(ParticleVect&                              particleVect,
+                                 const SPHAlgorithms::Volume&               volume,
+                                 const std::vector<Obstacle>&               obstacles,
+                                 const SPHAlgorithms::VectorOfSizetVectors& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&          periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Detects collisions with several cached obstacle fields, every field is tested only for its own
+     * candidates. The fields are sampled in the local space of the obstacles, so they are reused while
+     * the obstacles move.
+     */
     static void detectCollisions(ParticleVect&                                    particleVect,
                                  const SPHAlgorithms::Volume&                     volume,
-                                 const std::function<float(float, float, float)>* obstacle = nullptr);
+                                 const std::vector<Obstacle>&                     obstacles,
+                                 const std::vector<SPHAlgorithms::DistanceField>& obstacleFields,
+                                 const SPHAlgorithms::VectorOfSizetVectors&       obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&                periodicity =
+                                     SPHAlgorithms::Periodicity());
+
+private:
+    static void
+    detectParticleCollisions(ParticleVect& particleVect, size_t i, const SPHAlgorithms::Periodicity& periodicity);
+
+    static void detectBoundaryCollision(Particle&                         particle,
+                                        const SPHAlgorithms::Cuboid&      cuboid,
+                                        const SPHAlgorithms::Periodicity& periodicity);
+
+    /**
+     * @brief Pushes the particle back into the domain of the volume along the border normal, if it has a domain.
+     */
+    static void detectDomainCollision(Particle& particle, const SPHAlgorithms::Volume& volume);
+
+    static void detectParticleAndBoundaryCollisions(ParticleVect&                     particleVect,
+                                                    const SPHAlgorithms::Volume&      volume,
+                                                    const SPHAlgorithms::Periodicity& periodicity);
+
+    template <class Equation> static void detectObstacleCollision(Particle& particle, const Equation& obstacle);
+
+    static void detectObstacleCollision(Particle& particle, const SPHAlgorithms::DistanceField& obstacleField);
+
+    static void detectObstacleCollision(Particle& particle, const Obstacle& obstacle);
+
+    static void detectObstacleCollision(Particle&                           particle,
+                                        const Obstacle&                     obstacle,
+                                        const SPHAlgorithms::DistanceField& obstacleField);
 };
 
 } // namespace SPHSDK
 
+#include "Collisions.hpp"
+
 #endif // COLLISIONS_H_73C34465A6ED4DB9B9F2F4C3937BF5DC
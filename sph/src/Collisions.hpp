@@ -0,0 +1,76 @@
+/**
+ * @file Collisions.hpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Config.h"
+#include "algorithms/src/Area.h"
+
+namespace SPHSDK
+{
+
+template <class Equation, class>
+void Collision::detectCollisions(ParticleVect&                     particleVect,
+                                 const SPHAlgorithms::Volume&      volume,
+                                 const Equation&                   obstacle,
+                                 const SPHAlgorithms::Periodicity& periodicity)
+{
+    const SPHAlgorithms::Cuboid cuboid = volume.getBoundingCuboid();
+
+    for (size_t i = 0; i < particleVect.size(); i++)
+    {
+        /* Particle Collision */
+
+        detectParticleCollisions(particleVect, i, periodicity);
+
+        /* Boundary Collision */
+
+        detectBoundaryCollision(particleVect[i], cuboid, periodicity);
+
+        detectDomainCollision(particleVect[i], volume);
+
+        /* Obstacle collision */
+
+        detectObstacleCollision(particleVect[i], obstacle);
+    }
+}
+
+template <class Equation, class>
+void Collision::detectCollisions(ParticleVect&                     particleVect,
+                                 const SPHAlgorithms::Volume&      volume,
+                                 const Equation&                   obstacle,
+                                 const SPHAlgorithms::SizetVector& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity& periodicity)
+{
+    detectParticleAndBoundaryCollisions(particleVect, volume, periodicity);
+
+    for (size_t i = 0; i < obstacleCandidates.size(); i++)
+        detectObstacleCollision(particleVect[obstacleCandidates[i]], obstacle);
+}
+
+template <class Equation, class>
+void Collision::detectCollisions(ParticleVect&                              particleVect,
+                                 const SPHAlgorithms::Volume&               volume,
+                                 const std::vector<Equation>&               obstacles,
+                                 const SPHAlgorithms::VectorOfSizetVectors& obstacleCandidates,
+                                 const SPHAlgorithms::Periodicity&          periodicity)
+{
+    detectParticleAndBoundaryCollisions(particleVect, volume, periodicity);
+
+    for (size_t obstacleIndex = 0; obstacleIndex < obstacles.size(); obstacleIndex++)
+        for (size_t i = 0; i < obstacleCandidates[obstacleIndex].size(); i++)
+            detectObstacleCollision(particleVect[obstacleCandidates[obstacleIndex][i]], obstacles[obstacleIndex]);
+}
+
+template <class Equation> void Collision::detectObstacleCollision(Particle& particle, const Equation& obstacle)
+{
+    if (obstacle(static_cast<float>(particle.position.x), static_cast<float>(particle.position.y),
+                 static_cast<float>(particle.position.z)) > 0.f)
+    {
+        particle.position = particle.previous_position;
+        particle.velocity *= Config::CollisionVelocityMultiplier;
+    }
+}
+
+} // namespace SPHSDK
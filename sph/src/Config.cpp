@@ -27,4 +27,26 @@ namespace SPHSDK
     const double Config::SpeedTreshold = 3.0;
 
     const double Config::CubeSize = 3.0;
+
+    const double Config::ObstacleFieldCellSize = 0.05;
+
+    // about the rest distance of the fluid particles
+    const double Config::BoundaryParticleSpacing = 0.03;
+
+    const size_t Config::KernelTableSamplesNumber = 1024;
+
+    // about ten times the speed of the fluid falling from the top of the cube, so the density varies by ~1%
+    const double Config::WaterSoundSpeed = 20.0;
+    const double Config::TaitExponent = 7.0;
+    const double Config::DensityDiffusionCoefficient = 0.1;
+    const double Config::CourantNumber = 0.4;
+    const double Config::MaxTimeStep = 0.01;
+    // the steps of the multiple time step solver are 1/16 of the coarsest one at least
+    const size_t Config::MaxTimeStepLevel = 4;
+
+    const double Config::DensityErrorTolerance = 0.001;
+    const size_t Config::MaxPressureIterations = 50;
+
+    const double Config::ViscosityErrorTolerance = 1e-5;
+    const size_t Config::MaxViscosityIterations = 100;
 } //SPHSDK
@@ -29,6 +29,25 @@ struct Config
 
     static const double CubeSize;
 
+    static const double ObstacleFieldCellSize;
+
+    static const double BoundaryParticleSpacing;
+
+    static const size_t KernelTableSamplesNumber;
+
+    static const double WaterSoundSpeed;
+    static const double TaitExponent;
+    static const double DensityDiffusionCoefficient;
+    static const double CourantNumber;
+    static const double MaxTimeStep;
+    static const size_t MaxTimeStepLevel;
+
+    static const double DensityErrorTolerance;
+    static const size_t MaxPressureIterations;
+
+    static const double ViscosityErrorTolerance;
+    static const size_t MaxViscosityIterations;
+
 }; //Config
 } //SPHSDK
 
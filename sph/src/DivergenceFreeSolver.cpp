@@ -0,0 +1,281 @@
+/**
+ * @file DivergenceFreeSolver.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "DivergenceFreeSolver.h"
+
+#include "Forces.h"
+#include "Kernels.h"
+
+#include <algorithm>
+
+namespace SPHSDK
+{
+
+template <class Kernel>
+DivergenceFreeSolverT<Kernel>::DivergenceFreeSolverT(bool   divergenceSolve,
+                                                     double densityErrorTolerance,
+                                                     size_t maxIterationsNumber)
+    : m_divergenceSolve(divergenceSolve)
+    , m_densityErrorTolerance(densityErrorTolerance)
+    , m_maxIterationsNumber(maxIterationsNumber)
+    , m_densityIterationsNumber(0u)
+    , m_divergenceIterationsNumber(0u)
+    , m_densityError(0.)
+    , m_divergenceError(0.)
+{
+}
+
+template <class Kernel> double DivergenceFreeSolverT<Kernel>::step(ParticleVect& particles)
+{
+    computeDensitiesAndFactors(particles);
+
+    const double timeStep = calcCourantTimeStep(particles);
+
+    if (m_divergenceSolve)
+        correctDivergenceError(particles, timeStep);
+
+    for (auto& particle : particles)
+        particle.pressure = 0.;
+
+    // the pressure is zero, so the total force is the viscosity, the gravity and the surface tension
+    ForcesT<double, Kernel>::ComputeForces(particles, m_periodicity);
+
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    if (m_implicitViscosity)
+    {
+        m_implicitViscosity->integrate(particles, timeStep, m_periodicity);
+    }
+    else
+    {
+#pragma omp parallel for
+        for (int i = 0; i < particlesNumber; i++)
+            particles[i].velocity += particles[i].fTotal / particles[i].density * timeStep;
+    }
+
+    correctDensityError(particles, timeStep);
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        particles[i].previous_position = particles[i].position;
+        particles[i].position += particles[i].velocity * timeStep;
+    }
+
+    return timeStep;
+}
+
+template <class Kernel> void DivergenceFreeSolverT<Kernel>::setImplicitViscosity(double viscosity)
+{
+    m_implicitViscosity.reset(new ImplicitViscosityT<Kernel>(viscosity));
+}
+
+template <class Kernel> const ImplicitViscosityT<Kernel>* DivergenceFreeSolverT<Kernel>::getImplicitViscosity() const
+{
+    return m_implicitViscosity.get();
+}
+
+template <class Kernel> size_t DivergenceFreeSolverT<Kernel>::getDensityIterationsNumber() const
+{
+    return m_densityIterationsNumber;
+}
+
+template <class Kernel> size_t DivergenceFreeSolverT<Kernel>::getDivergenceIterationsNumber() const
+{
+    return m_divergenceIterationsNumber;
+}
+
+template <class Kernel> double DivergenceFreeSolverT<Kernel>::getDensityError() const
+{
+    return m_densityError;
+}
+
+template <class Kernel> double DivergenceFreeSolverT<Kernel>::getDivergenceError() const
+{
+    return m_divergenceError;
+}
+
+template <class Kernel> void DivergenceFreeSolverT<Kernel>::computeDensitiesAndFactors(ParticleVect& particles)
+{
+    const double mass = Config::WaterParticleMass;
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    m_factors.resize(particles.size());
+    m_kappas.resize(particles.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        Particle& particle = particles[i];
+
+        particle.density = mass * Kernel::value(0., particle.supportRadius);
+
+        SPHAlgorithms::Point3D gradientSum;
+        double gradientSqrSum = 0.;
+
+        for (const size_t neighbourIndex : particle.neighbours)
+        {
+            const Particle& neighbour = particles[neighbourIndex];
+
+            const SPHAlgorithms::Point3D differenceParticleNeighbour =
+                calcDifference(particle, neighbour, m_periodicity);
+            const double distanceSqr = differenceParticleNeighbour.calcNormSqr();
+            const double supportRadius = symmetrizedSupportRadius(particle.supportRadius, neighbour.supportRadius);
+
+            if (distanceSqr <= 0. || distanceSqr >= supportRadius * supportRadius)
+                continue;
+
+            particle.density += mass * Kernel::value(distanceSqr, supportRadius);
+
+            const SPHAlgorithms::Point3D gradient =
+                Kernel::pressureGradient(differenceParticleNeighbour, supportRadius) * mass;
+
+            gradientSum += gradient;
+            gradientSqrSum += gradient.calcNormSqr();
+        }
+
+        const double denominator = gradientSum.calcNormSqr() + gradientSqrSum;
+
+        // the lonely particle has no neighbours to push
+        m_factors[i] = denominator > 0. ? particle.density / denominator : 0.;
+    }
+}
+
+template <class Kernel>
+double DivergenceFreeSolverT<Kernel>::calcDensityRate(const ParticleVect& particles, size_t index) const
+{
+    const double mass = Config::WaterParticleMass;
+    const Particle& particle = particles[index];
+
+    double densityRate = 0.;
+
+    for (const size_t neighbourIndex : particle.neighbours)
+    {
+        const Particle& neighbour = particles[neighbourIndex];
+
+        const SPHAlgorithms::Point3D differenceParticleNeighbour =
+            calcDifference(particle, neighbour, m_periodicity);
+        const double distanceSqr = differenceParticleNeighbour.calcNormSqr();
+        const double supportRadius = symmetrizedSupportRadius(particle.supportRadius, neighbour.supportRadius);
+
+        if (distanceSqr <= 0. || distanceSqr >= supportRadius * supportRadius)
+            continue;
+
+        densityRate += mass * SPHAlgorithms::calcDotProduct(
+                                  particle.velocity - neighbour.velocity,
+                                  Kernel::pressureGradient(differenceParticleNeighbour, supportRadius));
+    }
+
+    return densityRate;
+}
+
+template <class Kernel>
+void DivergenceFreeSolverT<Kernel>::correctVelocities(ParticleVect& particles, double timeStep) const
+{
+    const double mass = Config::WaterParticleMass;
+    const int particlesNumber = static_cast<int>(particles.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        Particle& particle = particles[i];
+
+        const double particleKappa = m_kappas[i] / particle.density;
+
+        for (const size_t neighbourIndex : particle.neighbours)
+        {
+            const Particle& neighbour = particles[neighbourIndex];
+
+            const SPHAlgorithms::Point3D differenceParticleNeighbour =
+                calcDifference(particle, neighbour, m_periodicity);
+            const double distanceSqr = differenceParticleNeighbour.calcNormSqr();
+            const double supportRadius = symmetrizedSupportRadius(particle.supportRadius, neighbour.supportRadius);
+
+            if (distanceSqr <= 0. || distanceSqr >= supportRadius * supportRadius)
+                continue;
+
+            particle.velocity += Kernel::pressureGradient(differenceParticleNeighbour, supportRadius) *
+                                 (-timeStep * mass * (particleKappa + m_kappas[neighbourIndex] / neighbour.density));
+        }
+    }
+}
+
+template <class Kernel>
+void DivergenceFreeSolverT<Kernel>::correctDivergenceError(ParticleVect& particles, double timeStep)
+{
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    m_divergenceIterationsNumber = 0u;
+    m_divergenceError = 0.;
+
+    while (m_divergenceIterationsNumber < m_maxIterationsNumber)
+    {
+        double densityRateSum = 0.;
+
+        // kappa_i = alpha_i / dt * D(rho_i)/Dt makes the rate of the particle zero
+#pragma omp parallel for reduction(+ : densityRateSum)
+        for (int i = 0; i < particlesNumber; i++)
+        {
+            const double densityRate =
+                particles[i].density < Config::WaterDensity ? 0. : std::max(0., calcDensityRate(particles, i));
+
+            m_kappas[i] = m_factors[i] / timeStep * densityRate;
+            densityRateSum += densityRate;
+        }
+
+        m_divergenceError =
+            particles.empty() ? 0. : densityRateSum * timeStep / particlesNumber / Config::WaterDensity;
+
+        if (m_divergenceError < m_densityErrorTolerance)
+            break;
+
+        correctVelocities(particles, timeStep);
+
+        m_divergenceIterationsNumber++;
+    }
+}
+
+template <class Kernel>
+void DivergenceFreeSolverT<Kernel>::correctDensityError(ParticleVect& particles, double timeStep)
+{
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    m_densityIterationsNumber = 0u;
+    m_densityError = 0.;
+
+    while (m_densityIterationsNumber < m_maxIterationsNumber)
+    {
+        double densityErrorSum = 0.;
+
+        // kappa_i = alpha_i / dt^2 * (rho*_i - rho0) for the density predicted with the velocities
+#pragma omp parallel for reduction(+ : densityErrorSum)
+        for (int i = 0; i < particlesNumber; i++)
+        {
+            const double predictedDensity = particles[i].density + timeStep * calcDensityRate(particles, i);
+            const double densityError = std::max(0., predictedDensity - Config::WaterDensity);
+
+            m_kappas[i] = m_factors[i] / (timeStep * timeStep) * densityError;
+            densityErrorSum += densityError;
+        }
+
+        m_densityError = particles.empty() ? 0. : densityErrorSum / particlesNumber / Config::WaterDensity;
+
+        if (m_densityIterationsNumber >= MinDensityIterationsNumber && m_densityError < m_densityErrorTolerance)
+            break;
+
+        correctVelocities(particles, timeStep);
+
+        m_densityIterationsNumber++;
+    }
+}
+
+template class DivergenceFreeSolverT<MullerKernel<double>>;
+template class DivergenceFreeSolverT<TabulatedMullerKernel<double>>;
+template class DivergenceFreeSolverT<CubicSplineKernel<double>>;
+template class DivergenceFreeSolverT<WendlandC2Kernel<double>>;
+template class DivergenceFreeSolverT<WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
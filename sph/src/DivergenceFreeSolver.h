@@ -0,0 +1,126 @@
+/**
+ * @file DivergenceFreeSolver.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef DIVERGENCE_FREE_SOLVER_H_7AC84C6C264D45EFAEC233F674F96A4C
+#define DIVERGENCE_FREE_SOLVER_H_7AC84C6C264D45EFAEC233F674F96A4C
+
+#include "Config.h"
+#include "ImplicitViscosity.h"
+#include "Kernels.h"
+#include "Solver.h"
+
+#include <memory>
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class DivergenceFreeSolverTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief DivergenceFreeSolverT is DFSPH: two pressure solves correct the velocities of the step directly.
+ * The divergence-free solve removes the compressing part of the velocity divergence at the start of the step,
+ * the constant density solve corrects the velocities after the other forces, so the predicted density is
+ * the rest density. Both use the factors alpha_i = rho_i / (|sum m grad W_ij|^2 + sum |m grad W_ij|^2)
+ * computed once per step over the neighbour lists. The divergence-free solve skips the particles below the rest
+ * density, the particles near the walls and the free surface miss neighbours and are let to compress back.
+ * The iterations are parallel over the particles with OpenMP, every particle only writes its own values.
+ * The kernel policy of Kernels.h is used by the forces, the factors and the solves, it is instantiated for
+ * MullerKernel, TabulatedMullerKernel, CubicSplineKernel, WendlandC2Kernel and WendlandC4Kernel of double only.
+ */
+template <class Kernel> class DivergenceFreeSolverT : public Solver
+{
+    friend class TestEnvironment::DivergenceFreeSolverTestSuite;
+
+public:
+    /**
+     * @param divergenceSolve          Enables the divergence-free solve
+     * @param densityErrorTolerance    The mean relative density error to stop the iterations of both solves at,
+     *                                 the divergence error is the density change in the step
+     * @param maxIterationsNumber      The iterations of every solve are stopped there
+     */
+    explicit DivergenceFreeSolverT(bool   divergenceSolve = true,
+                                   double densityErrorTolerance = Config::DensityErrorTolerance,
+                                   size_t maxIterationsNumber = Config::MaxPressureIterations);
+
+    double step(ParticleVect& particles) override;
+
+    /**
+     * @brief Integrates the viscosity implicitly with the viscosity mu instead of the explicit viscosity of Forces,
+     * so the viscous fluids keep the time step of the velocity.
+     */
+    void setImplicitViscosity(double viscosity);
+
+    /**
+     * @brief Returns the implicit viscosity for its statistics, nullptr if the viscosity is explicit.
+     */
+    const ImplicitViscosityT<Kernel>* getImplicitViscosity() const;
+
+    size_t getDensityIterationsNumber() const;
+
+    size_t getDivergenceIterationsNumber() const;
+
+    /**
+     * @brief Returns the mean relative compression predicted by the last iteration of the constant density solve.
+     */
+    double getDensityError() const;
+
+    /**
+     * @brief Returns the mean relative compression rate times the step of the last divergence-free iteration.
+     */
+    double getDivergenceError() const;
+
+private:
+    static const size_t MinDensityIterationsNumber = 2u;
+
+    /**
+     * @brief Sums the densities with the own mass and the factors alpha of the particles.
+     */
+    void computeDensitiesAndFactors(ParticleVect& particles);
+
+    /**
+     * @brief Returns the rate of the density change for the velocities.
+     */
+    double calcDensityRate(const ParticleVect& particles, size_t index) const;
+
+    /**
+     * @brief Changes the velocities by -dt * sum m_j * (kappa_i / rho_i + kappa_j / rho_j) * grad W_ij.
+     */
+    void correctVelocities(ParticleVect& particles, double timeStep) const;
+
+    void correctDivergenceError(ParticleVect& particles, double timeStep);
+
+    void correctDensityError(ParticleVect& particles, double timeStep);
+
+    bool m_divergenceSolve;
+
+    double m_densityErrorTolerance;
+
+    size_t m_maxIterationsNumber;
+
+    size_t m_densityIterationsNumber;
+
+    size_t m_divergenceIterationsNumber;
+
+    double m_densityError;
+
+    double m_divergenceError;
+
+    std::vector<double> m_factors;
+
+    std::vector<double> m_kappas;
+
+    std::unique_ptr<ImplicitViscosityT<Kernel>> m_implicitViscosity;
+};
+
+using DivergenceFreeSolver = DivergenceFreeSolverT<MullerKernel<double>>;
+
+} // namespace SPHSDK
+
+#endif // DIVERGENCE_FREE_SOLVER_H_7AC84C6C264D45EFAEC233F674F96A4C
@@ -1,177 +1,215 @@
 #include "Forces.h"
 
-#define _USE_MATH_DEFINES
-#include <cfloat>
-#include <math.h>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 namespace SPHSDK
 {
 
-static const double PiPowH9 = M_PI * pow(Config::WaterSupportRadius, 9);
-static const double PiPowH6 = M_PI * pow(Config::WaterSupportRadius, 6);
-static const double SupportRadiusSqr = Config::WaterSupportRadius * Config::WaterSupportRadius;
-static const double KernelDefaultMultiplier = 315.0 / (64.0 * PiPowH9);
-static const double KernelDefaultGradientMultiplier = -945.0 / (32.0 * PiPowH9);
-static const double KernelPressureGradientMultiplier = -45.0 / PiPowH6;
-static const double KernelViscosityLaplacianMultiplier = 45.0 / PiPowH6;
-static const double OwnDensity = 315.0 / (64.0 * M_PI * pow(Config::WaterSupportRadius, 3));
-
-
-static double defaultKernel(const SPHAlgorithms::Point3D& differenceParticleNeighbour) {
-    // (Formula 4.3)
-    const double particleDistanceSqr = differenceParticleNeighbour.calcNormSqr();
-    return KernelDefaultMultiplier * pow(SupportRadiusSqr - particleDistanceSqr, 3);
-}
-
-static SPHAlgorithms::Point3D defaultKernelGradient(const SPHAlgorithms::Point3D& differenceParticleNeighbour) {
-    // (Formula 4.4)
-    const double particleDistanceSqr = differenceParticleNeighbour.calcNormSqr();
-    return differenceParticleNeighbour * KernelDefaultGradientMultiplier
-                                       * (SupportRadiusSqr - particleDistanceSqr)
-                                       * (SupportRadiusSqr - particleDistanceSqr);
-}
-
-static double defaultKernelLaplacian(const SPHAlgorithms::Point3D& differenceParticleNeighbour) {
-    // (Formula 4.5)
-    const double particleDistanceSqr = differenceParticleNeighbour.calcNormSqr();
-    return KernelDefaultGradientMultiplier * (SupportRadiusSqr - particleDistanceSqr)
-                                           * (3.0 * SupportRadiusSqr - 7.0 * particleDistanceSqr);
-}
-
-static SPHAlgorithms::Point3D pressureKernelGradient(const SPHAlgorithms::Point3D& differenceParticleNeighbour) {
-    // (Formula 4.14)
-    const double particleDistance = differenceParticleNeighbour.calcNorm();
-    return differenceParticleNeighbour * KernelPressureGradientMultiplier / particleDistance
-                                       * (Config::WaterSupportRadius - particleDistance)
-                                       * (Config::WaterSupportRadius - particleDistance);
-}
-
-static double viscosityKernelLaplacian(const SPHAlgorithms::Point3D& differenceParticleNeighbour) {
-    // (Formula 4.22)
-    const double particleDistance = differenceParticleNeighbour.calcNorm();
-    return KernelViscosityLaplacianMultiplier * (Config::WaterSupportRadius - particleDistance);
+template <class Scalar>
+static Scalar symmetrizedSupportRadius(const ParticleT<Scalar>& particle, const ParticleT<Scalar>& neighbour)
+{
+    return symmetrizedSupportRadius(particle.supportRadius, neighbour.supportRadius);
 }
 
-void Forces::ComputeDensity(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeDensity(ParticleVectT<Scalar>&            particleVect,
+                                             const SPHAlgorithms::Periodicity& periodicity)
 {
+    const Scalar mass = static_cast<Scalar>(Config::WaterParticleMass);
+
     // (Formula 4.6)
     for (size_t i = 0; i < particleVect.size(); i++)
     {
-        particleVect[i].density = OwnDensity;
+        // (Formula 4.3 for the zero distance)
+        particleVect[i].density = Kernel::value(Scalar(0), particleVect[i].supportRadius);
 
         for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
         {
-            const SPHAlgorithms::Point3D differenceParticleNeighbour =
-                particleVect[i].position - particleVect[particleVect[i].neighbours[j]].position;
-
-            if (Config::WaterSupportRadius - differenceParticleNeighbour.calcNorm() > DBL_EPSILON)
-                particleVect[i].density += Config::WaterParticleMass * defaultKernel(differenceParticleNeighbour);
+            const ParticleT<Scalar>& neighbour = particleVect[particleVect[i].neighbours[j]];
+            const Point differenceParticleNeighbour = calcDifference(particleVect[i], neighbour, periodicity);
+            const Scalar supportRadius = symmetrizedSupportRadius(particleVect[i], neighbour);
+            const Scalar maxDistance = supportRadius - std::numeric_limits<Scalar>::epsilon();
+
+            if (differenceParticleNeighbour.calcNormSqr() < maxDistance * maxDistance)
+                particleVect[i].density +=
+                    mass * Kernel::value(differenceParticleNeighbour.calcNormSqr(), supportRadius);
         }
     }
 }
 
-void Forces::ComputePressure(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputePressure(ParticleVectT<Scalar>& particleVect)
 {
     // (Formula 4.12)
     for (auto& particle : particleVect)
     {
-        particle.pressure = Config::WaterStiffness * (particle.density - Config::WaterDensity);
+        particle.pressure = static_cast<Scalar>(Config::WaterStiffness) *
+                            (particle.density - static_cast<Scalar>(Config::WaterDensity));
     }
 }
 
-void Forces::ComputeInternalForces(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeInternalForces(ParticleVectT<Scalar>&            particleVect,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
 {
     for (size_t i = 0; i < particleVect.size(); i++)
+        ForcesT::ComputeInternalForces(particleVect, i, periodicity);
+}
+
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeInternalForces(ParticleVectT<Scalar>&            particleVect,
+                                                    size_t                            i,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
+{
+    const Scalar mass = static_cast<Scalar>(Config::WaterParticleMass);
+
+    particleVect[i].fPressure = Point();
+    particleVect[i].fViscosity = Point();
+
+    for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
     {
-        particleVect[i].fPressure = SPHAlgorithms::Point3D();
-        particleVect[i].fViscosity = SPHAlgorithms::Point3D();
+        assert(std::abs(particleVect[i].density) > 0.);
+        assert(std::abs(particleVect[particleVect[i].neighbours[j]].density) > 0.);
 
-        for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
+        const Point differenceParticleNeighbour =
+            calcDifference(particleVect[i], particleVect[particleVect[i].neighbours[j]], periodicity);
+
+        const Scalar particleDistanceSqr = differenceParticleNeighbour.calcNormSqr();
+        const Scalar supportRadius =
+            symmetrizedSupportRadius(particleVect[i], particleVect[particleVect[i].neighbours[j]]);
+
+        if (particleDistanceSqr > 0. && particleDistanceSqr < supportRadius * supportRadius)
         {
-            assert(std::abs(particleVect[i].density) > 0.);
-            assert(std::abs(particleVect[particleVect[i].neighbours[j]].density) > 0.);
-
-            const SPHAlgorithms::Point3D differenceParticleNeighbour =
-                particleVect[i].position - particleVect[particleVect[i].neighbours[j]].position;
-
-            const double particleDistance = differenceParticleNeighbour.calcNorm();
-
-            if (std::abs(particleDistance) > 0.)
-            {
-                const double dividedMassDensity =
-                    Config::WaterParticleMass / particleVect[particleVect[i].neighbours[j]].density;
-
-                // (Formulae 4.11 & 4.14)
-                particleVect[i].fPressure +=
-                    pressureKernelGradient(differenceParticleNeighbour) *
-                    (particleVect[i].pressure + particleVect[particleVect[i].neighbours[j]].pressure) *
-                    dividedMassDensity;
-
-                // (Formulae 4.17 & 4.22)
-                particleVect[i].fViscosity +=
-                    (particleVect[particleVect[i].neighbours[j]].velocity - particleVect[i].velocity) *
-                    viscosityKernelLaplacian(differenceParticleNeighbour) * dividedMassDensity;
-            }
+            const Scalar dividedMassDensity = mass / particleVect[particleVect[i].neighbours[j]].density;
+
+            // (Formulae 4.11 & 4.14)
+            particleVect[i].fPressure +=
+                Kernel::pressureGradient(differenceParticleNeighbour, supportRadius) *
+                (particleVect[i].pressure + particleVect[particleVect[i].neighbours[j]].pressure) *
+                dividedMassDensity;
+
+            // (Formulae 4.17 & 4.22)
+            particleVect[i].fViscosity +=
+                (particleVect[particleVect[i].neighbours[j]].velocity - particleVect[i].velocity) *
+                Kernel::viscosityLaplacian(particleDistanceSqr, supportRadius) * dividedMassDensity;
         }
+    }
+
+    particleVect[i].fPressure *= Scalar(-0.5);
+    particleVect[i].fViscosity *= static_cast<Scalar>(Config::WaterViscosity);
+
+    particleVect[i].fInternal = particleVect[i].fPressure + particleVect[i].fViscosity;
+}
+
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputePressureForce(ParticleVectT<Scalar>&            particleVect,
+                                                   const SPHAlgorithms::Periodicity& periodicity)
+{
+    const Scalar mass = static_cast<Scalar>(Config::WaterParticleMass);
+
+    for (size_t i = 0; i < particleVect.size(); i++)
+    {
+        particleVect[i].fPressure = Point();
 
-        particleVect[i].fPressure *= -0.5;
-        particleVect[i].fViscosity *= Config::WaterViscosity;
+        for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
+        {
+            const ParticleT<Scalar>& neighbour = particleVect[particleVect[i].neighbours[j]];
+            const Point differenceParticleNeighbour = calcDifference(particleVect[i], neighbour, periodicity);
+            const Scalar particleDistanceSqr = differenceParticleNeighbour.calcNormSqr();
+            const Scalar supportRadius = symmetrizedSupportRadius(particleVect[i], neighbour);
+
+            // (Formulae 4.11 & 4.14)
+            if (particleDistanceSqr > 0. && particleDistanceSqr < supportRadius * supportRadius)
+                particleVect[i].fPressure += Kernel::pressureGradient(differenceParticleNeighbour, supportRadius) *
+                                             (particleVect[i].pressure + neighbour.pressure) * mass /
+                                             neighbour.density;
+        }
 
-        particleVect[i].fInternal = particleVect[i].fPressure + particleVect[i].fViscosity;
+        particleVect[i].fPressure *= Scalar(-0.5);
     }
 }
 
-void Forces::ComputeGravityForce(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeGravityForce(ParticleVectT<Scalar>& particleVect)
 {
+    const Point gravitationalAcceleration(static_cast<Scalar>(Config::GravitationalAcceleration.x),
+                                          static_cast<Scalar>(Config::GravitationalAcceleration.y),
+                                          static_cast<Scalar>(Config::GravitationalAcceleration.z));
+
     for (auto& particle : particleVect)
     {
-        particle.fGravity = Config::GravitationalAcceleration * particle.density;
+        particle.fGravity = gravitationalAcceleration * particle.density;
     }
 }
 
-void Forces::ComputeSurfaceTension(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeSurfaceTension(ParticleVectT<Scalar>&            particleVect,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
 {
     for (size_t i = 0; i < particleVect.size(); i++)
+        ForcesT::ComputeSurfaceTension(particleVect, i, periodicity);
+}
+
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeSurfaceTension(ParticleVectT<Scalar>&            particleVect,
+                                                    size_t                            i,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
+{
+    const Scalar mass = static_cast<Scalar>(Config::WaterParticleMass);
+
+    particleVect[i].fSurfaceTension = Point();
+
+    Point surfaceTensionGradient = Point();
+    Scalar surfaceTensionLaplacian = 0;
+
+    // the neighbours found within the skin beyond the support radius are not counted
+    size_t neighboursNumber = 0u;
+
+    for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
     {
-        particleVect[i].fSurfaceTension = SPHAlgorithms::Point3D();
+        assert(std::abs(particleVect[i].density) > 0.);
+        assert(std::abs(particleVect[particleVect[i].neighbours[j]].density) > 0.);
 
-        SPHAlgorithms::Point3D surfaceTensionGradient = SPHAlgorithms::Point3D();
-        double surfaceTensionLaplacian = 0.0;
+        const Point differenceParticleNeighbour =
+            calcDifference(particleVect[i], particleVect[particleVect[i].neighbours[j]], periodicity);
 
-        for (size_t j = 0; j < particleVect[i].neighbours.size(); j++)
-        {
-            assert(std::abs(particleVect[i].density) > 0.);
-            assert(std::abs(particleVect[particleVect[i].neighbours[j]].density) > 0.);
+        const Scalar supportRadius =
+            symmetrizedSupportRadius(particleVect[i], particleVect[particleVect[i].neighbours[j]]);
 
-            const SPHAlgorithms::Point3D differenceParticleNeighbour =
-                particleVect[i].position - particleVect[particleVect[i].neighbours[j]].position;
+        if (differenceParticleNeighbour.calcNormSqr() <= supportRadius * supportRadius)
+        {
+            const Scalar dividedMassDensity = mass / particleVect[particleVect[i].neighbours[j]].density;
 
-            if (differenceParticleNeighbour.calcNormSqr() <= SupportRadiusSqr)
-            {
-                const double dividedMassDensity =
-                    Config::WaterParticleMass / particleVect[particleVect[i].neighbours[j]].density;
+            neighboursNumber++;
 
-                // (Formulae 4.28 & 4.4)
-                surfaceTensionGradient += defaultKernelGradient(differenceParticleNeighbour) * dividedMassDensity;
+            // (Formulae 4.28 & 4.4)
+            surfaceTensionGradient +=
+                Kernel::gradient(differenceParticleNeighbour, supportRadius) * dividedMassDensity;
 
-                // (Formulae 4.27 & 4.5)
-                surfaceTensionLaplacian += defaultKernelLaplacian(differenceParticleNeighbour) * dividedMassDensity;
-            }
+            // (Formulae 4.27 & 4.5)
+            surfaceTensionLaplacian +=
+                Kernel::laplacian(differenceParticleNeighbour.calcNormSqr(), supportRadius) *
+                dividedMassDensity;
         }
-
-        // (Formulae 4.32 & 5.17)
-        if (surfaceTensionGradient.calcNorm() >= std::sqrt(Config::WaterDensity / particleVect[i].neighbours.size()))
-            // (Formula 4.26 is presented by combination of 4.27 & 4.5 - laplacian - and 4.28 & 4.4 - gradient)
-            particleVect[i].fSurfaceTension = -surfaceTensionGradient / surfaceTensionGradient.calcNorm() *
-                                               surfaceTensionLaplacian * Config::WaterSurfaceTension;
     }
+
+    // (Formulae 4.32 & 5.17)
+    if (surfaceTensionGradient.calcNorm() >=
+        std::sqrt(static_cast<Scalar>(Config::WaterDensity) / neighboursNumber))
+        // (Formula 4.26 is presented by combination of 4.27 & 4.5 - laplacian - and 4.28 & 4.4 - gradient)
+        particleVect[i].fSurfaceTension = -surfaceTensionGradient / surfaceTensionGradient.calcNorm() *
+                                           surfaceTensionLaplacian *
+                                           static_cast<Scalar>(Config::WaterSurfaceTension);
 }
 
-void Forces::ComputeExternalForces(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeExternalForces(ParticleVectT<Scalar>&            particleVect,
+                                                    const SPHAlgorithms::Periodicity& periodicity)
 {
-    Forces::ComputeGravityForce(particleVect);
-    Forces::ComputeSurfaceTension(particleVect);
+    ForcesT::ComputeGravityForce(particleVect);
+    ForcesT::ComputeSurfaceTension(particleVect, periodicity);
 
     for (auto& particle : particleVect)
     {
@@ -179,12 +217,21 @@ void Forces::ComputeExternalForces(ParticleVect& particleVect)
     }
 }
 
-void Forces::ComputeAllForces(ParticleVect& particleVect)
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeAllForces(ParticleVectT<Scalar>&            particleVect,
+                                               const SPHAlgorithms::Periodicity& periodicity)
+{
+    ForcesT::ComputeDensity(particleVect, periodicity);
+    ForcesT::ComputePressure(particleVect);
+    ForcesT::ComputeForces(particleVect, periodicity);
+}
+
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeForces(ParticleVectT<Scalar>&            particleVect,
+                                            const SPHAlgorithms::Periodicity& periodicity)
 {
-    Forces::ComputeDensity(particleVect);
-    Forces::ComputePressure(particleVect);
-    Forces::ComputeInternalForces(particleVect);
-    Forces::ComputeExternalForces(particleVect);
+    ForcesT::ComputeInternalForces(particleVect, periodicity);
+    ForcesT::ComputeExternalForces(particleVect, periodicity);
 
     for (auto& particle : particleVect)
     {
@@ -192,4 +239,37 @@ void Forces::ComputeAllForces(ParticleVect& particleVect)
     }
 }
 
+template <class Scalar, class Kernel>
+void ForcesT<Scalar, Kernel>::ComputeForces(ParticleVectT<Scalar>&            particleVect,
+                                            const SPHAlgorithms::SizetVector& active,
+                                            const SPHAlgorithms::Periodicity& periodicity)
+{
+    const Point gravitationalAcceleration(static_cast<Scalar>(Config::GravitationalAcceleration.x),
+                                          static_cast<Scalar>(Config::GravitationalAcceleration.y),
+                                          static_cast<Scalar>(Config::GravitationalAcceleration.z));
+
+    for (const size_t i : active)
+    {
+        ParticleT<Scalar>& particle = particleVect[i];
+
+        ForcesT::ComputeInternalForces(particleVect, i, periodicity);
+        ForcesT::ComputeSurfaceTension(particleVect, i, periodicity);
+
+        particle.fGravity = gravitationalAcceleration * particle.density;
+        particle.fExternal = particle.fSurfaceTension + particle.fGravity;
+        particle.fTotal = particle.fExternal + particle.fInternal;
+    }
+}
+
+template class ForcesT<double, MullerKernel<double>>;
+template class ForcesT<float, MullerKernel<float>>;
+template class ForcesT<double, TabulatedMullerKernel<double>>;
+template class ForcesT<float, TabulatedMullerKernel<float>>;
+template class ForcesT<double, CubicSplineKernel<double>>;
+template class ForcesT<float, CubicSplineKernel<float>>;
+template class ForcesT<double, WendlandC2Kernel<double>>;
+template class ForcesT<float, WendlandC2Kernel<float>>;
+template class ForcesT<double, WendlandC4Kernel<double>>;
+template class ForcesT<float, WendlandC4Kernel<float>>;
+
 } // namespace SPHSDK
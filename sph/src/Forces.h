@@ -9,6 +9,7 @@
 
 #include "Collisions.h"
 #include "Config.h"
+#include "Kernels.h"
 #include "Particle.h"
 
 namespace SPHSDK
@@ -19,29 +20,80 @@ namespace TestEnvironment
     class ForcesTestSuite;
 } // TestEnvironment
 
-class Forces
+/**
+ * @brief ForcesT class computes the forces in the precision of the particles with the kernel policy
+ * from Kernels.h, the policy is inlined into the loops.
+ * It is instantiated for double and float with MullerKernel, TabulatedMullerKernel, CubicSplineKernel,
+ * WendlandC2Kernel and WendlandC4Kernel only.
+ * The neighbours across the periodic axes of the periodicity are taken at their nearest images.
+ */
+template <class Scalar, class Kernel = MullerKernel<Scalar>> class ForcesT
 {
     friend class TestEnvironment::ForcesTestSuite;
 
 public:
 
-    static void ComputeAllForces(ParticleVect& particleVect);
+    static void ComputeAllForces(ParticleVectT<Scalar>&            particleVect,
+                                 const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Computes the forces from the density and the pressure already set by the solver.
+     */
+    static void ComputeForces(ParticleVectT<Scalar>&            particleVect,
+                              const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Computes the forces of the active particles only, the other particles keep theirs. The density and
+     * the pressure of the neighbours are used as they are, the multiple time step solver predicts them.
+     */
+    static void ComputeForces(ParticleVectT<Scalar>&            particleVect,
+                              const SPHAlgorithms::SizetVector& active,
+                              const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Computes only the pressure force, the pressure solvers iterate it with the other forces fixed.
+     */
+    static void ComputePressureForce(ParticleVectT<Scalar>&            particleVect,
+                                     const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Computes the density by summation over the neighbours, the boundary adds its density after it.
+     */
+    static void ComputeDensity(ParticleVectT<Scalar>&            particleVect,
+                               const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Computes the pressure by the linear equation of state (Formula 4.12).
+     */
+    static void ComputePressure(ParticleVectT<Scalar>& particleVect);
 
 private:
 
-    static void ComputeDensity(ParticleVect& particleVect);
+    using Point = SPHAlgorithms::Point3<Scalar>;
+
+    static void ComputeSurfaceTension(ParticleVectT<Scalar>&            particleVect,
+                                      const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    static void ComputeSurfaceTension(ParticleVectT<Scalar>&            particleVect,
+                                      size_t                            i,
+                                      const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
 
-    static void ComputePressure(ParticleVect& particleVect);
+    static void ComputeGravityForce(ParticleVectT<Scalar>& particleVect);
 
-    static void ComputeSurfaceTension(ParticleVect& particleVect);
+    static void ComputeInternalForces(ParticleVectT<Scalar>&            particleVect,
+                                      const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
 
-    static void ComputeGravityForce(ParticleVect& particleVect);
+    static void ComputeInternalForces(ParticleVectT<Scalar>&            particleVect,
+                                      size_t                            i,
+                                      const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
 
-    static void ComputeInternalForces(ParticleVect& particleVect);
+    static void ComputeExternalForces(ParticleVectT<Scalar>&            particleVect,
+                                      const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
 
-    static void ComputeExternalForces(ParticleVect& particleVect);
+}; // ForcesT
 
-}; // Forces
+using Forces = ForcesT<double>;
+using ForcesF = ForcesT<float>;
 
 } // SPHSDK
 
@@ -0,0 +1,112 @@
+/**
+ * @file ImplicitViscosity.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "ImplicitViscosity.h"
+
+namespace SPHSDK
+{
+
+template <class Kernel>
+ImplicitViscosityT<Kernel>::ImplicitViscosityT(double viscosity, double errorTolerance, size_t maxIterationsNumber)
+    : m_viscosity(viscosity)
+    , m_solver(errorTolerance, maxIterationsNumber)
+{
+}
+
+template <class Kernel>
+void ImplicitViscosityT<Kernel>::integrate(ParticleVect&                     particles,
+                                           double                            timeStep,
+                                           const SPHAlgorithms::Periodicity& periodicity)
+{
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    assemble(particles, timeStep, periodicity);
+
+    m_rhs.resize(particles.size());
+    m_velocities.resize(particles.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        const Particle& particle = particles[i];
+
+        m_rhs[i] = particle.velocity + (particle.fTotal - particle.fViscosity) / particle.density * timeStep;
+        m_velocities[i] = particle.velocity;
+    }
+
+    m_solver.solve(m_matrix, m_rhs, m_velocities);
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        Particle& particle = particles[i];
+
+        const SPHAlgorithms::Point3D fViscosity = (m_velocities[i] - m_rhs[i]) * (particle.density / timeStep);
+
+        particle.fInternal = particle.fInternal - particle.fViscosity + fViscosity;
+        particle.fTotal = particle.fTotal - particle.fViscosity + fViscosity;
+        particle.fViscosity = fViscosity;
+        particle.velocity = m_velocities[i];
+    }
+}
+
+template <class Kernel> size_t ImplicitViscosityT<Kernel>::getIterationsNumber() const
+{
+    return m_solver.getStatistics().iterationsNumber;
+}
+
+template <class Kernel> double ImplicitViscosityT<Kernel>::getResidual() const
+{
+    return m_solver.getStatistics().residual;
+}
+
+template <class Kernel>
+void ImplicitViscosityT<Kernel>::assemble(const ParticleVect&               particles,
+                                          double                            timeStep,
+                                          const SPHAlgorithms::Periodicity& periodicity)
+{
+    const double mass = Config::WaterParticleMass;
+    const int particlesNumber = static_cast<int>(particles.size());
+
+    m_matrix.setPattern(particles);
+
+#pragma omp parallel for
+    for (int i = 0; i < particlesNumber; i++)
+    {
+        const Particle& particle = particles[i];
+
+        double diagonal = 1.;
+
+        for (size_t pair = m_matrix.getPairsBegin(i); pair < m_matrix.getPairsEnd(i); pair++)
+        {
+            const Particle& neighbour = particles[m_matrix.getColumn(pair)];
+
+            const double distanceSqr = calcDifference(particle, neighbour, periodicity).calcNormSqr();
+            const double supportRadius = symmetrizedSupportRadius(particle.supportRadius, neighbour.supportRadius);
+
+            if (distanceSqr >= supportRadius * supportRadius)
+                continue;
+
+            // (Formulae 4.17 & 4.22)
+            const double coefficient = timeStep * m_viscosity * mass *
+                                       Kernel::viscosityLaplacian(distanceSqr, supportRadius) /
+                                       (particle.density * neighbour.density);
+
+            m_matrix.setCoefficient(pair, -coefficient);
+            diagonal += coefficient;
+        }
+
+        m_matrix.setDiagonal(i, diagonal);
+    }
+}
+
+template class ImplicitViscosityT<MullerKernel<double>>;
+template class ImplicitViscosityT<TabulatedMullerKernel<double>>;
+template class ImplicitViscosityT<CubicSplineKernel<double>>;
+template class ImplicitViscosityT<WendlandC2Kernel<double>>;
+template class ImplicitViscosityT<WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
@@ -0,0 +1,87 @@
+/**
+ * @file ImplicitViscosity.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef IMPLICIT_VISCOSITY_H_DFC931B67640431BA54C0E7F28123654
+#define IMPLICIT_VISCOSITY_H_DFC931B67640431BA54C0E7F28123654
+
+#include "Config.h"
+#include "Kernels.h"
+#include "Particle.h"
+
+#include "algorithms/src/LinearSolvers.h"
+
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class ImplicitViscosityTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief ImplicitViscosityT integrates the viscosity by the backward Euler scheme, so the time step is not limited
+ * by the viscosity and the fluids like honey keep the steps of the pressure solver.
+ * The new velocities solve v_i - dt * mu / rho_i * sum m / rho_j * lap W_ij * (v_j - v_i) = v*_i with the laplacian
+ * of the viscosity force of Forces. The matrix has the pattern of the neighbour lists and is assembled once per
+ * step, it is symmetric and diagonally dominant, so it is solved by the conjugate gradient with the diagonal
+ * preconditioner.
+ * The laplacian is the one of the kernel policy of Kernels.h, it is instantiated for the kernels of double only.
+ */
+template <class Kernel> class ImplicitViscosityT
+{
+    friend class TestEnvironment::ImplicitViscosityTestSuite;
+
+public:
+    /**
+     * @param viscosity              The dynamic viscosity mu, it replaces Config::WaterViscosity of Forces
+     * @param errorTolerance         The residual relative to the right-hand side to stop the iterations at
+     * @param maxIterationsNumber    The iterations are stopped there even if the residual is larger
+     */
+    explicit ImplicitViscosityT(double viscosity = Config::WaterViscosity,
+                                double errorTolerance = Config::ViscosityErrorTolerance,
+                                size_t maxIterationsNumber = Config::MaxViscosityIterations);
+
+    /**
+     * @brief Integrates the velocities by the forces computed by Forces except its explicit viscosity and by
+     * the implicit viscosity, fViscosity is replaced with the implicit one. The velocities before the step are
+     * the initial guess, they are close to the solution. The neighbours across the periodic axes are taken at
+     * their nearest images.
+     */
+    void integrate(ParticleVect&                     particles,
+                   double                            timeStep,
+                   const SPHAlgorithms::Periodicity& periodicity = SPHAlgorithms::Periodicity());
+
+    /**
+     * @brief Returns the amount of the iterations of the last solve.
+     */
+    size_t getIterationsNumber() const;
+
+    /**
+     * @brief Returns the residual of the last solve relative to its right-hand side.
+     */
+    double getResidual() const;
+
+private:
+    void assemble(const ParticleVect& particles, double timeStep, const SPHAlgorithms::Periodicity& periodicity);
+
+    double m_viscosity;
+
+    SPHAlgorithms::NeighbourMatrix m_matrix; // -dt * mu * m * lap W_ij / (rho_i * rho_j) of the pairs
+
+    SPHAlgorithms::ConjugateGradientSolver<SPHAlgorithms::Point3D> m_solver;
+
+    std::vector<SPHAlgorithms::Point3D> m_rhs;
+
+    std::vector<SPHAlgorithms::Point3D> m_velocities;
+};
+
+using ImplicitViscosity = ImplicitViscosityT<MullerKernel<double>>;
+
+} // namespace SPHSDK
+
+#endif // IMPLICIT_VISCOSITY_H_DFC931B67640431BA54C0E7F28123654
@@ -12,26 +12,76 @@
 namespace SPHSDK
 {
 
-void Integrator::integrate(double timeStep, ParticleVect& particles)
+template <class Scalar> void Integrator::integrate(double timeStep, ParticleVectT<Scalar>& particles, bool limitSpeed)
 {
+    Integrator::integrateStage<VerletScheme>(0u, timeStep, particles, limitSpeed);
+}
+
+template <class Scheme, class Scalar>
+void Integrator::integrateStage(size_t stage, double timeStep, ParticleVectT<Scalar>& particles, bool limitSpeed)
+{
+    const Scalar step = static_cast<Scalar>(timeStep);
+
     for (auto& particle : particles)
     {
-        particle.previous_position = particle.position;
+        if (stage == 0u)
+            particle.previous_position = particle.position;
 
-        const SPHAlgorithms::Point3D prevAcceleration = particle.acceleration;
+        Scheme::integrate(stage, step, particle, limitSpeed);
+    }
+}
 
-        if (std::abs(particle.density) > 0.)
-            particle.acceleration = particle.fTotal / particle.density;
+template <class Scalar> void Integrator::kick(double timeStep, ParticleT<Scalar>& particle)
+{
+    particle.acceleration = calcAcceleration(particle);
+    particle.velocity += particle.acceleration * static_cast<Scalar>(timeStep);
+}
 
-        const SPHAlgorithms::Point3D prevVelocity = particle.velocity;
+template <class Scalar> void Integrator::drift(double timeStep, ParticleVectT<Scalar>& particles)
+{
+    const Scalar step = static_cast<Scalar>(timeStep);
 
-        particle.velocity += (prevAcceleration + particle.acceleration) / 2.0 * timeStep;
+    for (auto& particle : particles)
+    {
+        particle.previous_position = particle.position;
+        particle.position += particle.velocity * step;
+    }
+}
+
+template <class Scalar> double Integrator::calcMechanicalEnergy(const ParticleVectT<Scalar>& particles)
+{
+    const SPHAlgorithms::Point3D& gravitationalAcceleration = Config::GravitationalAcceleration;
+
+    double energy = 0.;
 
-        if (particle.velocity.calcNormSqr() > Config::SpeedTreshold)
-            particle.velocity = prevVelocity;
+    for (const auto& particle : particles)
+    {
+        const double velocitySqr = particle.velocity.calcNormSqr();
+        const double height = gravitationalAcceleration.x * static_cast<double>(particle.position.x) +
+                              gravitationalAcceleration.y * static_cast<double>(particle.position.y) +
+                              gravitationalAcceleration.z * static_cast<double>(particle.position.z);
 
-        particle.position += prevVelocity * timeStep + prevAcceleration / 2.0 * timeStep * timeStep;
+        energy += Config::WaterParticleMass * (0.5 * velocitySqr - height);
     }
+
+    return energy;
 }
 
+template void Integrator::integrate<double>(double timeStep, ParticleVectT<double>& particles, bool limitSpeed);
+template void Integrator::integrate<float>(double timeStep, ParticleVectT<float>& particles, bool limitSpeed);
+template void Integrator::kick<double>(double timeStep, ParticleT<double>& particle);
+template void Integrator::kick<float>(double timeStep, ParticleT<float>& particle);
+template void Integrator::drift<double>(double timeStep, ParticleVectT<double>& particles);
+template void Integrator::drift<float>(double timeStep, ParticleVectT<float>& particles);
+template double Integrator::calcMechanicalEnergy<double>(const ParticleVectT<double>& particles);
+template double Integrator::calcMechanicalEnergy<float>(const ParticleVectT<float>& particles);
+template void Integrator::integrateStage<VerletScheme, double>(size_t, double, ParticleVectT<double>&, bool);
+template void Integrator::integrateStage<VerletScheme, float>(size_t, double, ParticleVectT<float>&, bool);
+template void Integrator::integrateStage<LeapfrogScheme, double>(size_t, double, ParticleVectT<double>&, bool);
+template void Integrator::integrateStage<LeapfrogScheme, float>(size_t, double, ParticleVectT<float>&, bool);
+template void Integrator::integrateStage<SymplecticEulerScheme, double>(size_t, double, ParticleVectT<double>&, bool);
+template void Integrator::integrateStage<SymplecticEulerScheme, float>(size_t, double, ParticleVectT<float>&, bool);
+template void Integrator::integrateStage<MidpointScheme, double>(size_t, double, ParticleVectT<double>&, bool);
+template void Integrator::integrateStage<MidpointScheme, float>(size_t, double, ParticleVectT<float>&, bool);
+
 } // SPHSDK
@@ -7,15 +7,205 @@
 #ifndef INTEGRATOR_H_73C34465A6ED4DB9B9F2F4C3937BF5DV
 #define INTEGRATOR_H_73C34465A6ED4DB9B9F2F4C3937BF5DV
 
+#include "Config.h"
 #include "Particle.h"
 
+#include <cmath>
+
 namespace SPHSDK
 {
 
+/**
+ * The scheme policies define the time integration which Integrator::integrateStage is instantiated with.
+ * Every policy provides
+ * - StagesNumber                                        - the force evaluations per step
+ * - integrate(stage, timeStep, particle, limitSpeed)    - advances the particle in the stage by its fTotal
+ * The forces are computed at the positions of the stage before it, the first stage starts at the positions of
+ * the step, where the forces of the single stage schemes are computed. The field acceleration keeps the last
+ * acceleration of the particle. The policies are inlined into the loop of Integrator over the particles.
+ * With limitSpeed the new velocity over Config::SpeedTreshold is replaced by the velocity of the start of
+ * the step.
+ */
+
+/**
+ * @brief Returns the acceleration fTotal / density of the particle, the last one if the density is zero.
+ */
+template <class Scalar> SPHAlgorithms::Point3<Scalar> calcAcceleration(const ParticleT<Scalar>& particle)
+{
+    return std::abs(particle.density) > 0. ? particle.fTotal / particle.density : particle.acceleration;
+}
+
+/**
+ * @brief Replaces the velocity of the particle by the previous one if it is over the speed limit.
+ */
+template <class Scalar>
+void limitVelocity(ParticleT<Scalar>& particle, const SPHAlgorithms::Point3<Scalar>& prevVelocity, bool limitSpeed)
+{
+    if (limitSpeed && particle.velocity.calcNormSqr() > Config::SpeedTreshold)
+        particle.velocity = prevVelocity;
+}
+
+/**
+ * @brief VerletScheme is the original scheme of the library: the velocity is changed by the mean of the previous
+ * and the current acceleration, the position by the previous velocity and acceleration. The position lags
+ * the velocity by a step, so the oscillations grow with any time step, the speed limit bounds them.
+ */
+struct VerletScheme
+{
+    static constexpr size_t StagesNumber = 1u;
+
+    template <class Scalar>
+    static void integrate(size_t /*stage*/, Scalar timeStep, ParticleT<Scalar>& particle, bool limitSpeed)
+    {
+        using Point = SPHAlgorithms::Point3<Scalar>;
+
+        const Point prevAcceleration = particle.acceleration;
+        particle.acceleration = calcAcceleration(particle);
+
+        const Point prevVelocity = particle.velocity;
+
+        particle.velocity += (prevAcceleration + particle.acceleration) / Scalar(2) * timeStep;
+        limitVelocity(particle, prevVelocity, limitSpeed);
+
+        particle.position += prevVelocity * timeStep + prevAcceleration / Scalar(2) * timeStep * timeStep;
+    }
+};
+
+/**
+ * @brief LeapfrogScheme is kick-drift-kick: the closing half kick of the previous step by the current
+ * acceleration, the opening half kick and the drift, i.e. the velocity Verlet. The velocity is synchronized
+ * with the positions of the forces, previous_position after the step, the positions are the ones of
+ * the symplectic Euler. The closing half kick takes the current time step, so the scheme is second order for
+ * the constant time step. The new particles have no acceleration, their velocity is taken for the half step
+ * before the start.
+ */
+struct LeapfrogScheme
+{
+    static constexpr size_t StagesNumber = 1u;
+
+    template <class Scalar>
+    static void integrate(size_t /*stage*/, Scalar timeStep, ParticleT<Scalar>& particle, bool limitSpeed)
+    {
+        using Point = SPHAlgorithms::Point3<Scalar>;
+
+        const Point prevAcceleration = particle.acceleration;
+        particle.acceleration = calcAcceleration(particle);
+
+        const Point prevVelocity = particle.velocity;
+
+        particle.velocity += (prevAcceleration + particle.acceleration) / Scalar(2) * timeStep;
+        limitVelocity(particle, prevVelocity, limitSpeed);
+
+        particle.position += (particle.velocity + particle.acceleration / Scalar(2) * timeStep) * timeStep;
+    }
+};
+
+/**
+ * @brief SymplecticEulerScheme kicks the velocity by the full step and drifts the position with the new velocity.
+ * It is first order but symplectic, the energy oscillates around the exact one without the drift.
+ */
+struct SymplecticEulerScheme
+{
+    static constexpr size_t StagesNumber = 1u;
+
+    template <class Scalar>
+    static void integrate(size_t /*stage*/, Scalar timeStep, ParticleT<Scalar>& particle, bool limitSpeed)
+    {
+        particle.acceleration = calcAcceleration(particle);
+
+        const SPHAlgorithms::Point3<Scalar> prevVelocity = particle.velocity;
+
+        particle.velocity += particle.acceleration * timeStep;
+        limitVelocity(particle, prevVelocity, limitSpeed);
+
+        particle.position += particle.velocity * timeStep;
+    }
+};
+
+/**
+ * @brief The semi-implicit Euler is the symplectic Euler: the velocity is explicit in the force and the position
+ * is implicit in the velocity. The other order, the drift by the old velocity first, would be the explicit Euler
+ * with the forces of the same positions.
+ */
+using SemiImplicitEulerScheme = SymplecticEulerScheme;
+
+/**
+ * @brief MidpointScheme is the second order Runge-Kutta: the first stage moves the particle to the middle of
+ * the step, the second one moves it from the start of the step by the velocity and the acceleration of
+ * the middle. The forces are computed twice per step, the start of the step is restored from previous_position
+ * and the velocity of the middle less the half kick of the first stage.
+ */
+struct MidpointScheme
+{
+    static constexpr size_t StagesNumber = 2u;
+
+    template <class Scalar>
+    static void integrate(size_t stage, Scalar timeStep, ParticleT<Scalar>& particle, bool limitSpeed)
+    {
+        using Point = SPHAlgorithms::Point3<Scalar>;
+
+        const Scalar halfStep = timeStep / Scalar(2);
+
+        // the velocity of the middle is not limited, the start of the step is restored from it
+        if (stage == 0u)
+        {
+            particle.acceleration = calcAcceleration(particle);
+
+            particle.position += particle.velocity * halfStep;
+            particle.velocity += particle.acceleration * halfStep;
+            return;
+        }
+
+        const Point startVelocity = particle.velocity - particle.acceleration * halfStep;
+        const Point middleVelocity = particle.velocity;
+
+        particle.acceleration = calcAcceleration(particle);
+
+        particle.velocity = startVelocity + particle.acceleration * timeStep;
+        limitVelocity(particle, startVelocity, limitSpeed);
+
+        particle.position = particle.previous_position + middleVelocity * timeStep;
+    }
+};
+
 class Integrator
 {
 public:
-    static void integrate(double timeStep, ParticleVect& particles);
+    /**
+    * @brief Integrates the particles of double or float precision by VerletScheme, the time step is converted
+    * to the precision.
+    * @param limitSpeed    Keeps the previous velocity if the new one exceeds Config::SpeedTreshold,
+    *                      the solvers with the stable time step do not need it
+    */
+    template <class Scalar>
+    static void integrate(double timeStep, ParticleVectT<Scalar>& particles, bool limitSpeed = true);
+
+    /**
+    * @brief Integrates the stage of the scheme in one pass over the particles, the forces of the particles are
+    * computed at the positions of the previous stage. The first stage keeps the positions of the step in
+    * previous_position for the collisions.
+    */
+    template <class Scheme, class Scalar>
+    static void integrateStage(size_t stage, double timeStep, ParticleVectT<Scalar>& particles,
+                               bool limitSpeed = true);
+
+    /**
+    * @brief Changes the velocity of the particle by its acceleration fTotal / density over the time step.
+    * The leapfrog of the multiple time step solver kicks the active particles only by the half steps.
+    */
+    template <class Scalar> static void kick(double timeStep, ParticleT<Scalar>& particle);
+
+    /**
+    * @brief Moves all the particles by their velocities, the previous positions are kept for the collisions.
+    */
+    template <class Scalar> static void drift(double timeStep, ParticleVectT<Scalar>& particles);
+
+    /**
+    * @brief Returns the kinetic and the gravitational potential energy of the particles in double, its drift over
+    * the steps without the external work shows the error of the scheme and the time step. The viscosity
+    * and the collisions dissipate it, so it should not grow.
+    */
+    template <class Scalar> static double calcMechanicalEnergy(const ParticleVectT<Scalar>& particles);
 };
 
 } //SPHSDK
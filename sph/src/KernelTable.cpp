@@ -0,0 +1,115 @@
+/**
+ * @file KernelTable.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "KernelTable.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace SPHSDK
+{
+
+template <class Scalar>
+KernelTable<Scalar>::KernelTable(size_t samplesNumber)
+    : m_samplesNumber(samplesNumber)
+    , m_samplesPerDistanceSqr(static_cast<Scalar>(samplesNumber - 1))
+    , m_samples(samplesNumber * shapesNumber)
+{
+    assert(samplesNumber >= 2);
+
+    for (size_t i = 0; i < m_samplesNumber; i++)
+    {
+        const Scalar distanceSqr = static_cast<Scalar>(i) / m_samplesPerDistanceSqr;
+
+        for (size_t shape = 0; shape < shapesNumber; shape++)
+            m_samples[i * shapesNumber + shape] = calcShape(static_cast<Shape>(shape), distanceSqr);
+    }
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::poly6(Scalar distanceSqr) const
+{
+    return interpolate(poly6Shape, distanceSqr);
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::poly6Gradient(Scalar distanceSqr) const
+{
+    return interpolate(poly6GradientShape, distanceSqr);
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::poly6Laplacian(Scalar distanceSqr) const
+{
+    return interpolate(poly6LaplacianShape, distanceSqr);
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::spikyGradient(Scalar distanceSqr) const
+{
+    if (distanceSqr < MinTabulatedSqrtDistanceSqr)
+        return calcShape(spikyGradientShape, distanceSqr);
+
+    return interpolate(spikyGradientShape, distanceSqr);
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::viscosityLaplacian(Scalar distanceSqr) const
+{
+    if (distanceSqr < MinTabulatedSqrtDistanceSqr)
+        return calcShape(viscosityLaplacianShape, distanceSqr);
+
+    return interpolate(viscosityLaplacianShape, distanceSqr);
+}
+
+template <class Scalar> size_t KernelTable<Scalar>::getSamplesNumber() const
+{
+    return m_samplesNumber;
+}
+
+/**
+ * @brief All the shapes are zero on the border of the support and outside of it.
+ */
+template <class Scalar> Scalar KernelTable<Scalar>::interpolate(Shape shape, Scalar distanceSqr) const
+{
+    const Scalar position = distanceSqr * m_samplesPerDistanceSqr;
+
+    if (!(position < m_samplesPerDistanceSqr))
+        return Scalar(0);
+
+    // the signed conversion is cheaper than the unsigned one, the position is not negative
+    const int index = static_cast<int>(position);
+    const Scalar weight = position - static_cast<Scalar>(index);
+
+    const Scalar lower = m_samples[index * shapesNumber + shape];
+    const Scalar upper = m_samples[(index + 1) * shapesNumber + shape];
+
+    return lower + weight * (upper - lower);
+}
+
+template <class Scalar> Scalar KernelTable<Scalar>::calcShape(Shape shape, Scalar distanceSqr)
+{
+    const Scalar complement = Scalar(1) - distanceSqr;
+
+    switch (shape)
+    {
+    case poly6Shape:
+        return complement * complement * complement;
+    case poly6GradientShape:
+        return complement * complement;
+    case poly6LaplacianShape:
+        return complement * (Scalar(3) - Scalar(7) * distanceSqr);
+    case spikyGradientShape:
+    {
+        const Scalar distance = std::sqrt(distanceSqr);
+        return distance > Scalar(0) ? (Scalar(1) - distance) * (Scalar(1) - distance) / distance : Scalar(0);
+    }
+    case viscosityLaplacianShape:
+        return Scalar(1) - std::sqrt(distanceSqr);
+    default:
+        return Scalar(0);
+    }
+}
+
+template class KernelTable<double>;
+template class KernelTable<float>;
+
+} // namespace SPHSDK
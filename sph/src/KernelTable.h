@@ -0,0 +1,82 @@
+/**
+ * @file KernelTable.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef KERNEL_TABLE_H_9B3E5D1A7C2F4A68B0E4D6C8A1F3B597
+#define KERNEL_TABLE_H_9B3E5D1A7C2F4A68B0E4D6C8A1F3B597
+
+#include <cstddef>
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class KernelTableTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief KernelTable class samples the shapes of the kernels over the squared normalized distance
+ * q^2 = r^2 / h^2 in [0, 1] and reads them with linear interpolation, so the pair needs neither pow nor sqrt.
+ * The shapes do not depend on the support radius, the caller multiplies them by the coefficient of h_ij:
+ * - poly6:              (1 - q^2)^3
+ * - poly6 gradient:     (1 - q^2)^2
+ * - poly6 laplacian:    (1 - q^2) * (3 - 7 * q^2)
+ * - spiky gradient:     (1 - q)^2 / q
+ * - viscous laplacian:  1 - q
+ * The shapes with q are steep near zero, so they are computed directly below MinTabulatedSqrtDistanceSqr.
+ * It is instantiated for double and float only.
+ */
+template <class Scalar> class KernelTable
+{
+    friend class TestEnvironment::KernelTableTestSuite;
+
+public:
+    static constexpr Scalar MinTabulatedSqrtDistanceSqr = Scalar(1) / Scalar(64);
+
+    /**
+     * @param samplesNumber    The amount of samples over q^2, it is at least 2
+     */
+    explicit KernelTable(size_t samplesNumber);
+
+    Scalar poly6(Scalar distanceSqr) const;
+
+    Scalar poly6Gradient(Scalar distanceSqr) const;
+
+    Scalar poly6Laplacian(Scalar distanceSqr) const;
+
+    Scalar spikyGradient(Scalar distanceSqr) const;
+
+    Scalar viscosityLaplacian(Scalar distanceSqr) const;
+
+    size_t getSamplesNumber() const;
+
+private:
+    enum Shape
+    {
+        poly6Shape,
+        poly6GradientShape,
+        poly6LaplacianShape,
+        spikyGradientShape,
+        viscosityLaplacianShape,
+        shapesNumber
+    };
+
+    Scalar interpolate(Shape shape, Scalar distanceSqr) const;
+
+    static Scalar calcShape(Shape shape, Scalar distanceSqr);
+
+private:
+    size_t m_samplesNumber;
+
+    Scalar m_samplesPerDistanceSqr;
+
+    std::vector<Scalar> m_samples; // the shapes of every sample are stored together
+};
+
+} // namespace SPHSDK
+
+#endif // KERNEL_TABLE_H_9B3E5D1A7C2F4A68B0E4D6C8A1F3B597
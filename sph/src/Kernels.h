@@ -0,0 +1,307 @@
+/**
+ * @file Kernels.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef KERNELS_H_7D2B9E4F1A6C4B38A0D5E3C1F8B2A694
+#define KERNELS_H_7D2B9E4F1A6C4B38A0D5E3C1F8B2A694
+
+#include "Config.h"
+#include "KernelTable.h"
+
+#include "algorithms/src/Point.h"
+
+#include <cmath>
+
+namespace SPHSDK
+{
+
+/**
+ * The kernel policies define the smoothing kernels which ForcesT is instantiated with.
+ * Every policy provides the static functions of the squared distance r^2 and the support radius h,
+ * the kernels vanish for r >= h:
+ * - value(r^2, h)                          - the kernel W for the density
+ * - gradient(difference, h)                - the gradient of W for the surface normal
+ * - laplacian(r^2, h)                      - the laplacian of W for the surface curvature
+ * - pressureGradient(difference, h)        - the gradient for the pressure force
+ * - viscosityLaplacian(r^2, h)             - the laplacian for the viscosity force
+ * The normalization coefficients are constexpr, only the powers of h are computed, so the policies are
+ * inlined into the loops of ForcesT. The families with one kernel use its gradient for the pressure and
+ * approximate the viscous laplacian by -2 * (r . gradient) / r^2, which stays positive.
+ */
+
+namespace Kernels
+{
+constexpr double Pi = 3.14159265358979323846;
+} // namespace Kernels
+
+/**
+ * @brief The kernels of the pair are evaluated with the symmetrized support radius h_ij = (h_i + h_j) / 2,
+ * so the particles of the different resolution act on each other equally.
+ */
+template <class Scalar> Scalar symmetrizedSupportRadius(Scalar supportRadius, Scalar neighbourSupportRadius)
+{
+    return Scalar(0.5) * (supportRadius + neighbourSupportRadius);
+}
+
+/**
+ * @brief MullerKernel uses poly6 for the density and the surface tension, spiky for the pressure and
+ * the viscous kernel for the viscosity (Formulae 4.3 - 4.5, 4.14 and 4.22).
+ */
+template <class Scalar> struct MullerKernel
+{
+    using Point = SPHAlgorithms::Point3<Scalar>;
+
+    static constexpr Scalar Poly6Coefficient = Scalar(315.0 / (64.0 * Kernels::Pi));
+    static constexpr Scalar Poly6GradientCoefficient = Scalar(-945.0 / (32.0 * Kernels::Pi));
+    static constexpr Scalar SpikyGradientCoefficient = Scalar(-45.0 / Kernels::Pi);
+    static constexpr Scalar ViscosityLaplacianCoefficient = Scalar(45.0 / Kernels::Pi);
+
+    static Scalar value(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        const Scalar difference = supportRadiusSqr - distanceSqr;
+        return Poly6Coefficient / powH9(supportRadius) * difference * difference * difference;
+    }
+
+    static Point gradient(const Point& difference, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        const Scalar complement = supportRadiusSqr - difference.calcNormSqr();
+        return difference * (Poly6GradientCoefficient / powH9(supportRadius) * complement * complement);
+    }
+
+    static Scalar laplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return Poly6GradientCoefficient / powH9(supportRadius) * (supportRadiusSqr - distanceSqr) *
+               (Scalar(3) * supportRadiusSqr - Scalar(7) * distanceSqr);
+    }
+
+    static Point pressureGradient(const Point& difference, Scalar supportRadius)
+    {
+        const Scalar distance = difference.calcNorm();
+        return difference * (SpikyGradientCoefficient / powH6(supportRadius) / distance *
+                             (supportRadius - distance) * (supportRadius - distance));
+    }
+
+    static Scalar viscosityLaplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        return ViscosityLaplacianCoefficient / powH6(supportRadius) * (supportRadius - std::sqrt(distanceSqr));
+    }
+
+    static Scalar powH6(Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return supportRadiusSqr * supportRadiusSqr * supportRadiusSqr;
+    }
+
+    static Scalar powH9(Scalar supportRadius)
+    {
+        return powH6(supportRadius) * supportRadius * supportRadius * supportRadius;
+    }
+};
+
+/**
+ * @brief The table is built on the first use, it serves every support radius.
+ */
+template <class Scalar> const KernelTable<Scalar>& getKernelTable()
+{
+    static const KernelTable<Scalar> table(Config::KernelTableSamplesNumber);
+    return table;
+}
+
+/**
+ * @brief TabulatedMullerKernel reads the kernels of MullerKernel from KernelTable, so the pair needs
+ * neither pow nor sqrt.
+ */
+template <class Scalar> struct TabulatedMullerKernel
+{
+    using Point = SPHAlgorithms::Point3<Scalar>;
+    using Analytic = MullerKernel<Scalar>;
+
+    static Scalar value(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return Analytic::Poly6Coefficient / (supportRadiusSqr * supportRadius) *
+               getKernelTable<Scalar>().poly6(distanceSqr / supportRadiusSqr);
+    }
+
+    static Point gradient(const Point& difference, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return difference * (Analytic::Poly6GradientCoefficient / powH5(supportRadius) *
+                             getKernelTable<Scalar>().poly6Gradient(difference.calcNormSqr() / supportRadiusSqr));
+    }
+
+    static Scalar laplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        return Analytic::Poly6GradientCoefficient / powH5(supportRadius) *
+               getKernelTable<Scalar>().poly6Laplacian(distanceSqr / (supportRadius * supportRadius));
+    }
+
+    static Point pressureGradient(const Point& difference, Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return difference * (Analytic::SpikyGradientCoefficient / powH5(supportRadius) *
+                             getKernelTable<Scalar>().spikyGradient(difference.calcNormSqr() / supportRadiusSqr));
+    }
+
+    static Scalar viscosityLaplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        return Analytic::ViscosityLaplacianCoefficient / powH5(supportRadius) *
+               getKernelTable<Scalar>().viscosityLaplacian(distanceSqr / (supportRadius * supportRadius));
+    }
+
+    static Scalar powH5(Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return supportRadiusSqr * supportRadiusSqr * supportRadius;
+    }
+};
+
+/**
+ * @brief SingleKernel builds the policy of the family from its shape in the normalized distance q = r / h.
+ * The shape provides the constexpr Coefficient and the functions w(q), w'(q) / q and w''(q) + 2 * w'(q) / q,
+ * so W = Coefficient / h^3 * w(q), its gradient is Coefficient / h^5 * w'(q) / q * difference and its
+ * laplacian is Coefficient / h^5 * (w''(q) + 2 * w'(q) / q).
+ */
+template <class Scalar, class Shape> struct SingleKernel
+{
+    using Point = SPHAlgorithms::Point3<Scalar>;
+
+    static Scalar value(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar q = std::sqrt(distanceSqr) / supportRadius;
+        return q < Scalar(1) ? Shape::Coefficient / (supportRadius * supportRadius * supportRadius) * Shape::value(q)
+                             : Scalar(0);
+    }
+
+    static Point gradient(const Point& difference, Scalar supportRadius)
+    {
+        return difference * gradientFactor(difference.calcNormSqr(), supportRadius);
+    }
+
+    static Scalar laplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar q = std::sqrt(distanceSqr) / supportRadius;
+        return q < Scalar(1) ? Shape::Coefficient / powH5(supportRadius) * Shape::laplacian(q) : Scalar(0);
+    }
+
+    static Point pressureGradient(const Point& difference, Scalar supportRadius)
+    {
+        return gradient(difference, supportRadius);
+    }
+
+    static Scalar viscosityLaplacian(Scalar distanceSqr, Scalar supportRadius)
+    {
+        return Scalar(-2) * gradientFactor(distanceSqr, supportRadius);
+    }
+
+    static Scalar gradientFactor(Scalar distanceSqr, Scalar supportRadius)
+    {
+        const Scalar q = std::sqrt(distanceSqr) / supportRadius;
+        return q < Scalar(1) ? Shape::Coefficient / powH5(supportRadius) * Shape::dividedDerivative(q) : Scalar(0);
+    }
+
+    static Scalar powH5(Scalar supportRadius)
+    {
+        const Scalar supportRadiusSqr = supportRadius * supportRadius;
+        return supportRadiusSqr * supportRadiusSqr * supportRadius;
+    }
+};
+
+namespace Kernels
+{
+
+/**
+ * @brief The cubic B-spline with the support h.
+ */
+template <class Scalar> struct CubicSplineShape
+{
+    static constexpr Scalar Coefficient = Scalar(8.0 / Pi);
+
+    static Scalar value(Scalar q)
+    {
+        return q <= Scalar(0.5) ? Scalar(6) * q * q * (q - Scalar(1)) + Scalar(1)
+                                : Scalar(2) * (Scalar(1) - q) * (Scalar(1) - q) * (Scalar(1) - q);
+    }
+
+    static Scalar dividedDerivative(Scalar q)
+    {
+        return q <= Scalar(0.5) ? Scalar(18) * q - Scalar(12) : Scalar(-6) * (Scalar(1) - q) * (Scalar(1) - q) / q;
+    }
+
+    static Scalar laplacian(Scalar q)
+    {
+        return q <= Scalar(0.5) ? Scalar(72) * q - Scalar(36)
+                                : Scalar(12) * (Scalar(1) - q) * (Scalar(2) * q - Scalar(1)) / q;
+    }
+};
+
+/**
+ * @brief The Wendland C2 kernel, it is smooth enough for the same accuracy with fewer neighbours.
+ */
+template <class Scalar> struct WendlandC2Shape
+{
+    static constexpr Scalar Coefficient = Scalar(21.0 / (2.0 * Pi));
+
+    static Scalar value(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        const Scalar complementSqr = complement * complement;
+        return complementSqr * complementSqr * (Scalar(1) + Scalar(4) * q);
+    }
+
+    static Scalar dividedDerivative(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        return Scalar(-20) * complement * complement * complement;
+    }
+
+    static Scalar laplacian(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        return Scalar(-60) * complement * complement * (Scalar(1) - Scalar(2) * q);
+    }
+};
+
+/**
+ * @brief The Wendland C4 kernel.
+ */
+template <class Scalar> struct WendlandC4Shape
+{
+    static constexpr Scalar Coefficient = Scalar(495.0 / (32.0 * Pi));
+
+    static Scalar value(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        const Scalar complementCube = complement * complement * complement;
+        return complementCube * complementCube * (Scalar(1) + Scalar(6) * q + Scalar(35.0 / 3.0) * q * q);
+    }
+
+    static Scalar dividedDerivative(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        const Scalar complementSqr = complement * complement;
+        return Scalar(-56.0 / 3.0) * (Scalar(1) + Scalar(5) * q) * complementSqr * complementSqr * complement;
+    }
+
+    static Scalar laplacian(Scalar q)
+    {
+        const Scalar complement = Scalar(1) - q;
+        const Scalar complementSqr = complement * complement;
+        return Scalar(-56) * complementSqr * complementSqr * (Scalar(1) + Scalar(4) * q - Scalar(15) * q * q);
+    }
+};
+
+} // namespace Kernels
+
+template <class Scalar> using CubicSplineKernel = SingleKernel<Scalar, Kernels::CubicSplineShape<Scalar>>;
+template <class Scalar> using WendlandC2Kernel = SingleKernel<Scalar, Kernels::WendlandC2Shape<Scalar>>;
+template <class Scalar> using WendlandC4Kernel = SingleKernel<Scalar, Kernels::WendlandC4Shape<Scalar>>;
+
+} // namespace SPHSDK
+
+#endif // KERNELS_H_7D2B9E4F1A6C4B38A0D5E3C1F8B2A694
@@ -0,0 +1,189 @@
+/**
+ * @file MultipleTimeStepSolver.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "MultipleTimeStepSolver.h"
+
+#include "Boundary.h"
+#include "Forces.h"
+#include "Integrator.h"
+
+#include <algorithm>
+
+namespace SPHSDK
+{
+
+template <class Kernel>
+MultipleTimeStepSolverT<Kernel>::MultipleTimeStepSolverT(size_t levelsNumber, bool densityDiffusion, double soundSpeed)
+    : WeaklyCompressibleSolverT<Kernel>(densityDiffusion, soundSpeed)
+    , m_levelsNumber(levelsNumber)
+    , m_tickTime(0.)
+    , m_tick(0u)
+{
+}
+
+template <class Kernel> double MultipleTimeStepSolverT<Kernel>::step(ParticleVect& particles)
+{
+    // all the particles start their steps at the first step
+    if (m_levels.size() != particles.size())
+    {
+        m_tick = 0u;
+        m_levels.assign(particles.size(), m_levelsNumber);
+        m_startTicks.assign(particles.size(), 0u);
+        m_endTicks.assign(particles.size(), 0u);
+        this->m_densityRates.assign(particles.size(), 0.);
+    }
+
+    m_active.clear();
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        if (m_endTicks[i] == m_tick)
+            m_active.push_back(i);
+    }
+
+    for (const size_t i : m_active)
+        this->m_densityRates[i] = this->calcDensityRate(particles, i);
+
+    // the pressure of the inactive neighbours follows their predicted densities
+    this->computePressure(particles);
+
+    ForcesT<double, Kernel>::ComputeForces(particles, m_active, this->m_periodicity);
+
+    if (this->m_boundary != nullptr)
+    {
+        for (const size_t i : m_active)
+            this->m_boundary->template addForces<Kernel>(particles, i);
+    }
+
+    // the closing half kick of the step ending now
+    for (const size_t i : m_active)
+        Integrator::kick(static_cast<double>(m_endTicks[i] - m_startTicks[i]) * m_tickTime / 2., particles[i]);
+
+    // all the particles end their steps together, the ticks start over
+    if (m_active.size() == particles.size())
+    {
+        m_tick = 0u;
+        m_endTicks.assign(particles.size(), 0u);
+
+        chooseTickTime(particles);
+    }
+
+    chooseLevels(particles);
+
+    // the opening half kick of the next step
+    for (const size_t i : m_active)
+    {
+        m_startTicks[i] = m_tick;
+        m_endTicks[i] = m_tick + calcStepTicks(m_levels[i]);
+
+        Integrator::kick(static_cast<double>(m_endTicks[i] - m_tick) * m_tickTime / 2., particles[i]);
+    }
+
+    const uint64_t nextTick = *std::min_element(m_endTicks.begin(), m_endTicks.end());
+    const double timeStep = static_cast<double>(nextTick - m_tick) * m_tickTime;
+
+    for (size_t i = 0; i < particles.size(); i++)
+        particles[i].density += this->m_densityRates[i] * timeStep;
+
+    Integrator::drift(timeStep, particles);
+
+    m_tick = nextTick;
+
+    return timeStep;
+}
+
+template <class Kernel> size_t MultipleTimeStepSolverT<Kernel>::getActiveParticlesNumber() const
+{
+    return m_active.size();
+}
+
+template <class Kernel> size_t MultipleTimeStepSolverT<Kernel>::getLevel(size_t particleIndex) const
+{
+    return m_levels[particleIndex];
+}
+
+template <class Kernel> uint64_t MultipleTimeStepSolverT<Kernel>::calcStepTicks(size_t level) const
+{
+    return uint64_t(1u) << (m_levelsNumber - level);
+}
+
+template <class Kernel> void MultipleTimeStepSolverT<Kernel>::chooseTickTime(const ParticleVect& particles)
+{
+    // the shortest stable step is the finest level, so the fluid of the same speeds steps as WCSPH does.
+    // The steps of the particles getting faster are not shortened below the tick until the next choice.
+    m_tickTime = this->calcTimeStep(particles);
+}
+
+template <class Kernel> void MultipleTimeStepSolverT<Kernel>::chooseLevels(ParticleVect& particles)
+{
+    for (const size_t i : m_active)
+    {
+        const double stableTimeStep = this->calcParticleTimeStep(particles[i]);
+
+        size_t level = 0u;
+        while (level < m_levelsNumber && static_cast<double>(calcStepTicks(level)) * m_tickTime > stableTimeStep)
+            level++;
+
+        m_levels[i] = level;
+    }
+
+    // the active particles follow their finer neighbours until the levels settle, the levels only increase
+    bool levelsChanged = true;
+
+    while (levelsChanged)
+    {
+        levelsChanged = false;
+
+        for (const size_t i : m_active)
+        {
+            size_t level = m_levels[i];
+
+            for (const size_t neighbourIndex : particles[i].neighbours)
+            {
+                if (m_levels[neighbourIndex] > level + 1u)
+                    level = m_levels[neighbourIndex] - 1u;
+            }
+
+            // the step starts at a multiple of its length
+            while (m_tick % calcStepTicks(level) != 0u)
+                level++;
+
+            if (level != m_levels[i])
+            {
+                m_levels[i] = level;
+                levelsChanged = true;
+            }
+        }
+    }
+
+    // the inactive neighbours more than one level coarser end their steps earlier, their opening half kick is
+    // taken back to the half of the shorter step
+    for (const size_t i : m_active)
+    {
+        for (const size_t neighbourIndex : particles[i].neighbours)
+        {
+            if (m_endTicks[neighbourIndex] == m_tick || m_levels[neighbourIndex] + 1u >= m_levels[i])
+                continue;
+
+            const size_t level = m_levels[i] - 1u;
+            const uint64_t endTick = (m_tick / calcStepTicks(level) + 1u) * calcStepTicks(level);
+
+            const double shortening = static_cast<double>(m_endTicks[neighbourIndex] - endTick) * m_tickTime;
+            particles[neighbourIndex].velocity += particles[neighbourIndex].acceleration * (-shortening / 2.);
+
+            m_levels[neighbourIndex] = level;
+            m_endTicks[neighbourIndex] = endTick;
+        }
+    }
+}
+
+template class MultipleTimeStepSolverT<MullerKernel<double>>;
+template class MultipleTimeStepSolverT<TabulatedMullerKernel<double>>;
+template class MultipleTimeStepSolverT<CubicSplineKernel<double>>;
+template class MultipleTimeStepSolverT<WendlandC2Kernel<double>>;
+template class MultipleTimeStepSolverT<WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
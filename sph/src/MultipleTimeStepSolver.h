@@ -0,0 +1,99 @@
+/**
+ * @file MultipleTimeStepSolver.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef MULTIPLE_TIME_STEP_SOLVER_H_7D34A3F7C7604FD9A8E8C4019B45A08E
+#define MULTIPLE_TIME_STEP_SOLVER_H_7D34A3F7C7604FD9A8E8C4019B45A08E
+
+#include "Config.h"
+#include "WeaklyCompressibleSolver.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class MultipleTimeStepSolverTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief MultipleTimeStepSolverT is WCSPH with the block time steps: every particle takes the time step
+ * tick * 2^(L - level) not longer than its own stable step, the levels 0..L are the power-of-two fractions of
+ * the coarsest step. A step of the solver goes to the next end of the particle steps; only the particles
+ * ending there (the active ones) get their forces and density rates recomputed and are kicked, all the particles
+ * are drifted and their densities are predicted by the last rates. The velocities are integrated by the leapfrog
+ * kick-drift-kick: the closing half kick of the old step and the opening half kick of the new one.
+ * The steps start at the multiples of their length, so the particles of the coarser levels end together with
+ * the finer ones. The levels of the neighbours differ by one at most: an active particle moving to a finer level
+ * shortens the current step of its slower neighbours. The tick is chosen again when all the particles end their
+ * steps together, the finest level is the shortest stable step of the particles then.
+ * It is instantiated for the kernel policies of WeaklyCompressibleSolverT.
+ */
+template <class Kernel> class MultipleTimeStepSolverT : public WeaklyCompressibleSolverT<Kernel>
+{
+    friend class TestEnvironment::MultipleTimeStepSolverTestSuite;
+
+public:
+    /**
+     * @param levelsNumber        The finest level L, the steps are 2^L ticks at most
+     * @param densityDiffusion    Adds the delta-SPH diffusion term to the continuity equation
+     * @param soundSpeed          The numerical speed of sound c0
+     */
+    explicit MultipleTimeStepSolverT(size_t levelsNumber = Config::MaxTimeStepLevel,
+                                     bool   densityDiffusion = true,
+                                     double soundSpeed = Config::WaterSoundSpeed);
+
+    double step(ParticleVect& particles) override;
+
+    /**
+     * @brief Returns the amount of the particles the forces were computed for in the last step.
+     */
+    size_t getActiveParticlesNumber() const;
+
+    /**
+     * @brief Returns the level of the current step of the particle, 0 is the coarsest one.
+     */
+    size_t getLevel(size_t particleIndex) const;
+
+private:
+    /**
+     * @brief Returns the length of the step of the level in ticks.
+     */
+    uint64_t calcStepTicks(size_t level) const;
+
+    /**
+     * @brief Chooses the tick by the stable steps of the particles, all the particles end their steps now.
+     */
+    void chooseTickTime(const ParticleVect& particles);
+
+    /**
+     * @brief Chooses the levels of the active particles by their stable steps and their neighbours, and
+     * shortens the steps of the neighbours more than one level coarser.
+     */
+    void chooseLevels(ParticleVect& particles);
+
+    size_t m_levelsNumber;
+
+    double m_tickTime;
+
+    uint64_t m_tick;
+
+    std::vector<size_t> m_levels;
+
+    std::vector<uint64_t> m_startTicks;
+
+    std::vector<uint64_t> m_endTicks;
+
+    SPHAlgorithms::SizetVector m_active;
+};
+
+using MultipleTimeStepSolver = MultipleTimeStepSolverT<MullerKernel<double>>;
+
+} // namespace SPHSDK
+
+#endif // MULTIPLE_TIME_STEP_SOLVER_H_7D34A3F7C7604FD9A8E8C4019B45A08E
@@ -0,0 +1,90 @@
+/**
+ * @file Obstacle.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Obstacle.h"
+
+namespace SPHSDK
+{
+
+Obstacle::Obstacle(const std::function<float(float, float, float)>& equation,
+                   const SPHAlgorithms::Cuboid&                     boundingCuboid,
+                   const SPHAlgorithms::RigidTransform&             transform)
+    : m_equation(equation)
+    , m_boundingCuboid(boundingCuboid)
+    , m_transform(transform)
+{
+}
+
+float Obstacle::operator()(float x, float y, float z) const
+{
+    return evaluateLocal(m_transform.toLocal(SPHAlgorithms::Point3D(x, y, z)));
+}
+
+float Obstacle::evaluateLocal(const SPHAlgorithms::Point3D& point) const
+{
+    return m_equation(static_cast<float>(point.x), static_cast<float>(point.y), static_cast<float>(point.z));
+}
+
+SPHAlgorithms::Cuboid Obstacle::getBoundingCuboid() const
+{
+    return m_transform.toWorld(m_boundingCuboid);
+}
+
+SPHAlgorithms::Cuboid Obstacle::getLocalBoundingCuboid() const
+{
+    return m_boundingCuboid;
+}
+
+const std::function<float(float, float, float)>& Obstacle::getEquation() const
+{
+    return m_equation;
+}
+
+const SPHAlgorithms::RigidTransform& Obstacle::getTransform() const
+{
+    return m_transform;
+}
+
+void Obstacle::setTransform(const SPHAlgorithms::RigidTransform& transform)
+{
+    m_transform = transform;
+}
+
+void Obstacle::setVelocity(const SPHAlgorithms::Point3D& linearVelocity, const SPHAlgorithms::Point3D& angularVelocity)
+{
+    m_linearVelocity = linearVelocity;
+    m_angularVelocity = angularVelocity;
+}
+
+SPHAlgorithms::Point3D Obstacle::getVelocity(const SPHAlgorithms::Point3D& point) const
+{
+    const SPHAlgorithms::Point3D r = point - m_transform.getTranslation();
+
+    // v + w x r
+    return m_linearVelocity + SPHAlgorithms::Point3D(m_angularVelocity.y * r.z - m_angularVelocity.z * r.y,
+                                                     m_angularVelocity.z * r.x - m_angularVelocity.x * r.z,
+                                                     m_angularVelocity.x * r.y - m_angularVelocity.y * r.x);
+}
+
+bool Obstacle::isMoving() const
+{
+    return m_linearVelocity != SPHAlgorithms::Point3D() || m_angularVelocity != SPHAlgorithms::Point3D();
+}
+
+void Obstacle::move(double dt)
+{
+    const SPHAlgorithms::Point3D origin = m_transform.getTranslation();
+
+    // rotate around the local origin, then move it
+    const SPHAlgorithms::RigidTransform step =
+        SPHAlgorithms::RigidTransform(origin + m_linearVelocity * dt) *
+        SPHAlgorithms::RigidTransform::fromAxisAngle(m_angularVelocity, m_angularVelocity.calcNorm() * dt) *
+        SPHAlgorithms::RigidTransform(-origin);
+
+    m_transform = step * m_transform;
+}
+
+} // namespace SPHSDK
@@ -0,0 +1,104 @@
+/**
+ * @file Obstacle.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef OBSTACLE_H_2B6F0D4E8A1C4F7B9E3D5A0C6B8F2E14
+#define OBSTACLE_H_2B6F0D4E8A1C4F7B9E3D5A0C6B8F2E14
+
+#include "algorithms/src/Area.h"
+#include "algorithms/src/RigidTransform.h"
+#include "algorithms/src/ShapeExpressions.h"
+
+#include <functional>
+
+namespace SPHSDK
+{
+
+/**
+ * @brief Obstacle class keeps the obstacle equation (> 0 inside the obstacle) together with its axis-aligned
+ * bounding cuboid. The equation must not be positive outside of the cuboid, so the collision phase tests
+ * only the particles near it.
+ * The equation and the cuboid are given in the local space of the obstacle, the rigid transform places
+ * the obstacle into the world. The obstacle moves with its linear and angular velocities, the rotation
+ * is around the local origin.
+ */
+class Obstacle
+{
+public:
+    /**
+     * @param equation          The obstacle equation
+     * @param boundingCuboid    The cuboid declared by the user which contains the obstacle
+     * @param transform         The placement of the obstacle in the world
+     */
+    Obstacle(const std::function<float(float, float, float)>& equation,
+             const SPHAlgorithms::Cuboid&                     boundingCuboid,
+             const SPHAlgorithms::RigidTransform&             transform = SPHAlgorithms::RigidTransform());
+
+    /**
+     * @brief Creates the obstacle from the shape expression, the bounding cuboid is computed automatically.
+     */
+    template <class Expression>
+    explicit Obstacle(const SPHAlgorithms::ShapeExpressions::ShapeExpression<Expression>& expression,
+                      const SPHAlgorithms::RigidTransform& transform = SPHAlgorithms::RigidTransform())
+        : Obstacle(expression.derived(), expression.derived().bounds(), transform)
+    {
+    }
+
+    /**
+     * @brief Evaluates the equation in the world point.
+     */
+    float operator()(float x, float y, float z) const;
+
+    /**
+     * @brief Evaluates the equation in the local point.
+     */
+    float evaluateLocal(const SPHAlgorithms::Point3D& point) const;
+
+    /**
+     * @brief Returns the world cuboid which contains the placed obstacle.
+     */
+    SPHAlgorithms::Cuboid getBoundingCuboid() const;
+
+    SPHAlgorithms::Cuboid getLocalBoundingCuboid() const;
+
+    const std::function<float(float, float, float)>& getEquation() const;
+
+    const SPHAlgorithms::RigidTransform& getTransform() const;
+
+    void setTransform(const SPHAlgorithms::RigidTransform& transform);
+
+    /**
+     * @param linearVelocity     The velocity of the local origin
+     * @param angularVelocity    The rotation axis scaled by the angular speed in radians per second
+     */
+    void setVelocity(const SPHAlgorithms::Point3D& linearVelocity, const SPHAlgorithms::Point3D& angularVelocity);
+
+    /**
+     * @brief Returns the velocity of the obstacle surface in the world point.
+     */
+    SPHAlgorithms::Point3D getVelocity(const SPHAlgorithms::Point3D& point) const;
+
+    bool isMoving() const;
+
+    /**
+     * @brief Moves the obstacle by its velocities during the time step.
+     */
+    void move(double dt);
+
+private:
+    std::function<float(float, float, float)> m_equation;
+
+    SPHAlgorithms::Cuboid m_boundingCuboid;
+
+    SPHAlgorithms::RigidTransform m_transform;
+
+    SPHAlgorithms::Point3D m_linearVelocity;
+
+    SPHAlgorithms::Point3D m_angularVelocity;
+};
+
+} // namespace SPHSDK
+
+#endif // OBSTACLE_H_2B6F0D4E8A1C4F7B9E3D5A0C6B8F2E14
@@ -0,0 +1,56 @@
+/**
+ * @file ObstacleIndex.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "ObstacleIndex.h"
+
+#include <map>
+
+namespace SPHSDK
+{
+
+ObstacleIndex::ObstacleIndex(const SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher,
+                             const std::vector<SPHAlgorithms::Cuboid>&              obstacleBounds,
+                             double                                                 margin)
+    : m_obstaclesNumber(obstacleBounds.size())
+{
+    // ordered by the box index, so the boxes are visited in the memory order
+    std::map<size_t, SPHAlgorithms::SizetVector> boxObstacles;
+
+    for (size_t obstacleIndex = 0u; obstacleIndex < obstacleBounds.size(); ++obstacleIndex)
+    {
+        const SPHAlgorithms::Cuboid bounds = SPHAlgorithms::expandCuboid(obstacleBounds[obstacleIndex], margin);
+
+        for (const size_t boxIndex : searcher.findBoxesNearCuboid(bounds))
+            boxObstacles[boxIndex].push_back(obstacleIndex);
+    }
+
+    for (auto& box : boxObstacles)
+    {
+        m_boxes.push_back(box.first);
+        m_boxObstacles.push_back(std::move(box.second));
+    }
+}
+
+SPHAlgorithms::VectorOfSizetVectors
+ObstacleIndex::findCandidates(const SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher) const
+{
+    SPHAlgorithms::VectorOfSizetVectors candidates(m_obstaclesNumber);
+
+    for (size_t i = 0u; i < m_boxes.size(); ++i)
+    {
+        const SPHAlgorithms::SizetVector& points = searcher.getPointsInBox(m_boxes[i]);
+
+        if (points.empty())
+            continue;
+
+        for (const size_t obstacleIndex : m_boxObstacles[i])
+            candidates[obstacleIndex].insert(candidates[obstacleIndex].end(), points.begin(), points.end());
+    }
+
+    return candidates;
+}
+
+} // namespace SPHSDK
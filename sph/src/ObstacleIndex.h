@@ -0,0 +1,65 @@
+/**
+ * @file ObstacleIndex.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef OBSTACLE_INDEX_H_6E2A9C4D1B7F4E3A8D5C0B9F2A6E1D47
+#define OBSTACLE_INDEX_H_6E2A9C4D1B7F4E3A8D5C0B9F2A6E1D47
+
+#include "Particle.h"
+
+#include "algorithms/src/Area.h"
+#include "algorithms/src/Defines.h"
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class ObstacleIndexTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief ObstacleIndex class maps the boxes of the neighbours search grid to the obstacles near them.
+ * The obstacles are static, so the index is built once and every step only the particles in the boxes
+ * near some obstacle are paired with the obstacles of their box. The cost depends on the amount of
+ * obstacles around the particles, not on the total amount of obstacles.
+ */
+class ObstacleIndex
+{
+    friend class TestEnvironment::ObstacleIndexTestSuite;
+
+public:
+    ObstacleIndex() = default;
+
+    /**
+     * @param searcher          The neighbours search whose boxes are indexed
+     * @param obstacleBounds    The bounding cuboids of the obstacles
+     * @param margin            The distance from the bounds at which particles are still tested
+     */
+    ObstacleIndex(const SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher,
+                  const std::vector<SPHAlgorithms::Cuboid>&              obstacleBounds,
+                  double                                                 margin);
+
+    /**
+     * @brief Returns the particles to test against every obstacle, the points in the boxes are taken
+     * from the last search.
+     */
+    SPHAlgorithms::VectorOfSizetVectors
+    findCandidates(const SPHAlgorithms::NeighboursSearch3D<ParticleVect>& searcher) const;
+
+private:
+    size_t m_obstaclesNumber = 0u;
+
+    SPHAlgorithms::SizetVector m_boxes; // the boxes near at least one obstacle
+
+    SPHAlgorithms::VectorOfSizetVectors m_boxObstacles; // the obstacles near every box from m_boxes
+};
+
+} // namespace SPHSDK
+
+#endif // OBSTACLE_INDEX_H_6E2A9C4D1B7F4E3A8D5C0B9F2A6E1D47
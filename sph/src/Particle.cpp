@@ -9,42 +9,47 @@
 namespace SPHSDK
 {
 
-Particle::Particle() :
-    radius(0.0),
-    density(0.0),
-    pressure(0.0),
-    mass(0.0),
-    supportRadius(0.0),
-    position(SPHAlgorithms::Point3D()),
-    velocity(SPHAlgorithms::Point3D()),
-    acceleration(SPHAlgorithms::Point3D()),
-    fGravity(SPHAlgorithms::Point3D()),
-    fSurfaceTension(SPHAlgorithms::Point3D()),
-    fViscosity(SPHAlgorithms::Point3D()),
-    fPressure(SPHAlgorithms::Point3D()),
-    fExternal(SPHAlgorithms::Point3D()),
-    fInternal(SPHAlgorithms::Point3D()),
-    fTotal(SPHAlgorithms::Point3D())
+template <class Scalar>
+ParticleT<Scalar>::ParticleT() :
+    radius(0),
+    density(0),
+    pressure(0),
+    mass(0),
+    supportRadius(static_cast<Scalar>(Config::WaterSupportRadius)),
+    position(Point()),
+    velocity(Point()),
+    acceleration(Point()),
+    fGravity(Point()),
+    fSurfaceTension(Point()),
+    fViscosity(Point()),
+    fPressure(Point()),
+    fExternal(Point()),
+    fInternal(Point()),
+    fTotal(Point())
 {
 }
 
-Particle::Particle(const SPHAlgorithms::Point3D & position, double radius) :
+template <class Scalar>
+ParticleT<Scalar>::ParticleT(const Point & position, Scalar radius) :
     radius(radius),
-    density(0.0),
-    pressure(0.0),
-    mass(0.0),
-    supportRadius(0.0),
+    density(0),
+    pressure(0),
+    mass(0),
+    supportRadius(static_cast<Scalar>(Config::WaterSupportRadius)),
     position(position),
-    velocity(SPHAlgorithms::Point3D()),
-    acceleration(SPHAlgorithms::Point3D()),
-    fGravity(SPHAlgorithms::Point3D()),
-    fSurfaceTension(SPHAlgorithms::Point3D()),
-    fViscosity(SPHAlgorithms::Point3D()),
-    fPressure(SPHAlgorithms::Point3D()),
-    fExternal(SPHAlgorithms::Point3D()),
-    fInternal(SPHAlgorithms::Point3D()),
-    fTotal(SPHAlgorithms::Point3D())
+    velocity(Point()),
+    acceleration(Point()),
+    fGravity(Point()),
+    fSurfaceTension(Point()),
+    fViscosity(Point()),
+    fPressure(Point()),
+    fExternal(Point()),
+    fInternal(Point()),
+    fTotal(Point())
 {
 }
 
+template class ParticleT<double>;
+template class ParticleT<float>;
+
 } // SPHSDK
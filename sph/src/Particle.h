@@ -9,6 +9,7 @@
 
 #include "Config.h"
 #include "algorithms/src/Defines.h"
+#include "algorithms/src/Periodicity.h"
 #include "algorithms/src/Point.h"
 
 namespace SPHSDK
@@ -20,42 +21,64 @@ class ParticleTestSuite;
 } // namespace TestEnvironment
 
 /**
- * @brief Particle class defines one particle object with properties.
+ * @brief ParticleT class defines one particle object with properties.
+ * The scalar type defines the precision of all the particle fields, the single precision particles halve
+ * the memory traffic of the solver. It is instantiated for double and float only.
  */
-class Particle
+template <class Scalar> class ParticleT
 {
     friend class TestEnvironment::ParticleTestSuite;
 
 public:
-    Particle();
+    using Point = SPHAlgorithms::Point3<Scalar>;
 
-    Particle(const SPHAlgorithms::Point3D& position, double radius = Config::ParticleRadius);
+    ParticleT();
 
-    double radius;
-    double density;
-    double pressure;
-    double mass;
-    double supportRadius;
+    ParticleT(const Point& position, Scalar radius = static_cast<Scalar>(Config::ParticleRadius));
 
-    SPHAlgorithms::Point3D position;
-    SPHAlgorithms::Point3D previous_position;
-    SPHAlgorithms::Point3D velocity;
-    SPHAlgorithms::Point3D acceleration;
+    Scalar radius;
+    Scalar density;
+    Scalar pressure;
+    Scalar mass;
+    Scalar supportRadius;
 
-    SPHAlgorithms::Point3D fGravity;
-    SPHAlgorithms::Point3D fSurfaceTension;
-    SPHAlgorithms::Point3D fViscosity;
-    SPHAlgorithms::Point3D fPressure;
+    Point position;
+    Point previous_position;
+    Point velocity;
+    Point acceleration;
 
-    SPHAlgorithms::Point3D fExternal;
-    SPHAlgorithms::Point3D fInternal;
+    Point fGravity;
+    Point fSurfaceTension;
+    Point fViscosity;
+    Point fPressure;
 
-    SPHAlgorithms::Point3D fTotal;
+    Point fExternal;
+    Point fInternal;
+
+    Point fTotal;
 
     SPHAlgorithms::SizetVector neighbours;
 };
 
-using ParticleVect = std::vector<Particle>;
+using Particle = ParticleT<double>;
+using ParticleF = ParticleT<float>;
+
+/**
+ * @brief Returns the difference of the positions of the particles, it is the one of the nearest images across
+ * the periodic axes of the periodicity.
+ */
+template <class Scalar>
+SPHAlgorithms::Point3<Scalar> calcDifference(const ParticleT<Scalar>&          particle,
+                                             const ParticleT<Scalar>&          neighbour,
+                                             const SPHAlgorithms::Periodicity& periodicity)
+{
+    return periodicity.calcMinimumImage(particle.position - neighbour.position);
+}
+
+template <class Scalar> using ParticleVectT = std::vector<ParticleT<Scalar>>;
+
+using ParticleVect = ParticleVectT<double>;
+using ParticleFVect = ParticleVectT<float>;
 using ParticleVectConstIter = ParticleVect::const_iterator;
 using ParticleVectIter = ParticleVect::iterator;
 
@@ -0,0 +1,198 @@
+/**
+ * @file PredictiveCorrectiveSolver.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "PredictiveCorrectiveSolver.h"
+
+#include "Forces.h"
+#include "Kernels.h"
+
+#include <algorithm>
+
+namespace SPHSDK
+{
+
+template <class Kernel>
+PredictiveCorrectiveSolverT<Kernel>::PredictiveCorrectiveSolverT(double densityErrorTolerance,
+                                                                 size_t maxIterationsNumber)
+    : m_densityErrorTolerance(densityErrorTolerance)
+    , m_maxIterationsNumber(maxIterationsNumber)
+    , m_iterationsNumber(0u)
+    , m_densityError(0.)
+{
+}
+
+template <class Kernel> double PredictiveCorrectiveSolverT<Kernel>::step(ParticleVect& particles)
+{
+    m_positions.resize(particles.size());
+    m_nonPressureForces.resize(particles.size());
+
+    for (size_t i = 0; i < particles.size(); i++)
+        m_positions[i] = particles[i].position;
+
+    computeDensities(particles, m_positions, m_densities);
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        particles[i].density = m_densities[i];
+        particles[i].pressure = 0.;
+    }
+
+    // the pressure is zero, so the total force is the viscosity, the gravity and the surface tension
+    ForcesT<double, Kernel>::ComputeForces(particles, m_periodicity);
+
+    for (size_t i = 0; i < particles.size(); i++)
+        m_nonPressureForces[i] = particles[i].fTotal;
+
+    const double timeStep = calcCourantTimeStep(particles);
+    const double pressureFactor = calcPressureFactor(particles, timeStep);
+
+    m_iterationsNumber = 0u;
+
+    while (m_iterationsNumber < m_maxIterationsNumber)
+    {
+        predictPositions(particles, timeStep);
+        computeDensities(particles, m_predictedPositions, m_densities);
+
+        double densityErrorSum = 0.;
+
+        for (size_t i = 0; i < particles.size(); i++)
+        {
+            // the particles near the free surface miss the neighbours, their expansion is not corrected
+            const double densityError = std::max(0., m_densities[i] - Config::WaterDensity);
+
+            particles[i].pressure += pressureFactor * densityError;
+            densityErrorSum += densityError;
+        }
+
+        m_densityError = particles.empty() ? 0. : densityErrorSum / particles.size() / Config::WaterDensity;
+
+        ForcesT<double, Kernel>::ComputePressureForce(particles, m_periodicity);
+
+        m_iterationsNumber++;
+
+        if (m_iterationsNumber >= MinIterationsNumber && m_densityError < m_densityErrorTolerance)
+            break;
+    }
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        Particle& particle = particles[i];
+
+        particle.fInternal = particle.fPressure + particle.fViscosity;
+        particle.fTotal = particle.fInternal + particle.fExternal;
+        particle.acceleration = particle.fTotal / particle.density;
+
+        particle.previous_position = particle.position;
+        particle.velocity += particle.acceleration * timeStep;
+        particle.position += particle.velocity * timeStep;
+    }
+
+    return timeStep;
+}
+
+template <class Kernel> size_t PredictiveCorrectiveSolverT<Kernel>::getIterationsNumber() const
+{
+    return m_iterationsNumber;
+}
+
+template <class Kernel> double PredictiveCorrectiveSolverT<Kernel>::getDensityError() const
+{
+    return m_densityError;
+}
+
+template <class Kernel>
+double PredictiveCorrectiveSolverT<Kernel>::calcPressureFactor(const ParticleVect& particles, double timeStep) const
+{
+    const auto prototype = std::max_element(particles.begin(), particles.end(), [](const auto& a, const auto& b) {
+        return a.neighbours.size() < b.neighbours.size();
+    });
+
+    if (prototype == particles.end())
+        return 0.;
+
+    // the density kernel gives the change of the density, the pressure kernel gives the displacement
+    SPHAlgorithms::Point3D densityGradientSum;
+    SPHAlgorithms::Point3D pressureGradientSum;
+    double gradientProductSum = 0.;
+
+    for (const size_t neighbourIndex : prototype->neighbours)
+    {
+        const Particle& neighbour = particles[neighbourIndex];
+
+        const SPHAlgorithms::Point3D differenceParticleNeighbour = calcDifference(*prototype, neighbour, m_periodicity);
+        const double distanceSqr = differenceParticleNeighbour.calcNormSqr();
+        const double supportRadius = symmetrizedSupportRadius(prototype->supportRadius, neighbour.supportRadius);
+
+        if (distanceSqr <= 0. || distanceSqr >= supportRadius * supportRadius)
+            continue;
+
+        const SPHAlgorithms::Point3D densityGradient = Kernel::gradient(differenceParticleNeighbour, supportRadius);
+        const SPHAlgorithms::Point3D pressureGradient =
+            Kernel::pressureGradient(differenceParticleNeighbour, supportRadius);
+
+        densityGradientSum += densityGradient;
+        pressureGradientSum += pressureGradient;
+        gradientProductSum += SPHAlgorithms::calcDotProduct(densityGradient, pressureGradient);
+    }
+
+    // the uniform pressure p moves the particle by -dt^2 * m * p / rho0^2 * sum grad W and every neighbour by
+    // the opposite of its term, so the density changes by -beta * p * (sum . sum + sum of the products)
+    const double mass = Config::WaterParticleMass;
+    const double beta = timeStep * timeStep * mass * mass / (Config::WaterDensity * Config::WaterDensity);
+    const double denominator =
+        beta * (SPHAlgorithms::calcDotProduct(densityGradientSum, pressureGradientSum) + gradientProductSum);
+
+    return denominator > 0. ? 1. / denominator : 0.;
+}
+
+template <class Kernel>
+void PredictiveCorrectiveSolverT<Kernel>::computeDensities(const ParticleVect&                        particles,
+                                                           const std::vector<SPHAlgorithms::Point3D>& positions,
+                                                           std::vector<double>&                       densities) const
+{
+    const double mass = Config::WaterParticleMass;
+
+    densities.resize(particles.size());
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        densities[i] = mass * Kernel::value(0., particles[i].supportRadius);
+
+        for (const size_t neighbourIndex : particles[i].neighbours)
+        {
+            const double distanceSqr =
+                m_periodicity.calcMinimumImage(positions[i] - positions[neighbourIndex]).calcNormSqr();
+            const double supportRadius =
+                symmetrizedSupportRadius(particles[i].supportRadius, particles[neighbourIndex].supportRadius);
+
+            if (distanceSqr < supportRadius * supportRadius)
+                densities[i] += mass * Kernel::value(distanceSqr, supportRadius);
+        }
+    }
+}
+
+template <class Kernel>
+void PredictiveCorrectiveSolverT<Kernel>::predictPositions(const ParticleVect& particles, double timeStep)
+{
+    m_predictedPositions.resize(particles.size());
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        const SPHAlgorithms::Point3D acceleration =
+            (m_nonPressureForces[i] + particles[i].fPressure) / particles[i].density;
+        const SPHAlgorithms::Point3D velocity = particles[i].velocity + acceleration * timeStep;
+
+        m_predictedPositions[i] = particles[i].position + velocity * timeStep;
+    }
+}
+
+template class PredictiveCorrectiveSolverT<MullerKernel<double>>;
+template class PredictiveCorrectiveSolverT<TabulatedMullerKernel<double>>;
+template class PredictiveCorrectiveSolverT<CubicSplineKernel<double>>;
+template class PredictiveCorrectiveSolverT<WendlandC2Kernel<double>>;
+template class PredictiveCorrectiveSolverT<WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
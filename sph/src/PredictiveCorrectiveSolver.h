@@ -0,0 +1,101 @@
+/**
+ * @file PredictiveCorrectiveSolver.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef PREDICTIVE_CORRECTIVE_SOLVER_H_23E48541A75B449DAEBCBB8E742F9B85
+#define PREDICTIVE_CORRECTIVE_SOLVER_H_23E48541A75B449DAEBCBB8E742F9B85
+
+#include "Config.h"
+#include "Kernels.h"
+#include "Solver.h"
+
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class PredictiveCorrectiveSolverTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief PredictiveCorrectiveSolverT is PCISPH: with the other forces fixed, the positions are predicted with
+ * the current pressure force, and the pressure is corrected by the density error at the predicted positions
+ * until the mean error is below the tolerance. The predicted densities are summed over the neighbour lists of
+ * the step, so the search is done once per step.
+ * The pressure acts in the same step, so the particles are integrated by the symplectic Euler scheme instead of
+ * Integrator, and the time step is limited by the velocity only.
+ * The kernel policy of Kernels.h is used by the forces, the densities and the pressure factor, it is
+ * instantiated for MullerKernel, TabulatedMullerKernel, CubicSplineKernel, WendlandC2Kernel and WendlandC4Kernel
+ * of double only.
+ */
+template <class Kernel> class PredictiveCorrectiveSolverT : public Solver
+{
+    friend class TestEnvironment::PredictiveCorrectiveSolverTestSuite;
+
+public:
+    /**
+     * @param densityErrorTolerance    The mean relative density error to stop the iterations at
+     * @param maxIterationsNumber      The iterations are stopped there even if the error is larger
+     */
+    explicit PredictiveCorrectiveSolverT(double densityErrorTolerance = Config::DensityErrorTolerance,
+                                         size_t maxIterationsNumber = Config::MaxPressureIterations);
+
+    double step(ParticleVect& particles) override;
+
+    /**
+     * @brief Returns the amount of the pressure iterations of the last step.
+     */
+    size_t getIterationsNumber() const;
+
+    /**
+     * @brief Returns the mean relative density error of the last step, the expansion is not counted.
+     */
+    double getDensityError() const;
+
+private:
+    /**
+     * @brief The iterations are not stopped before it, the first ones only build up the pressure.
+     */
+    static const size_t MinIterationsNumber = 3u;
+
+    /**
+     * @brief Returns the factor of the pressure correction for the particle with the full neighbourhood.
+     */
+    double calcPressureFactor(const ParticleVect& particles, double timeStep) const;
+
+    /**
+     * @brief Sums the density at the positions, the particle contributes its own mass. The neighbours across the
+     * periodic axes are taken at their nearest images.
+     */
+    void computeDensities(const ParticleVect&                        particles,
+                          const std::vector<SPHAlgorithms::Point3D>& positions,
+                          std::vector<double>&                       densities) const;
+
+    void predictPositions(const ParticleVect& particles, double timeStep);
+
+    double m_densityErrorTolerance;
+
+    size_t m_maxIterationsNumber;
+
+    size_t m_iterationsNumber;
+
+    double m_densityError;
+
+    std::vector<SPHAlgorithms::Point3D> m_positions;
+
+    std::vector<SPHAlgorithms::Point3D> m_predictedPositions;
+
+    std::vector<double> m_densities;
+
+    std::vector<SPHAlgorithms::Point3D> m_nonPressureForces;
+};
+
+using PredictiveCorrectiveSolver = PredictiveCorrectiveSolverT<MullerKernel<double>>;
+
+} // namespace SPHSDK
+
+#endif // PREDICTIVE_CORRECTIVE_SOLVER_H_23E48541A75B449DAEBCBB8E742F9B85
@@ -8,8 +8,6 @@
 
 #include "Collisions.h"
 #include "Config.h"
-#include "Forces.h"
-#include "Integrator.h"
 
 #include <cfloat>
 #include <cmath>
@@ -28,13 +26,36 @@ inline SPHAlgorithms::Point3D SpericalToCartesian(double r, double fi, double te
 }
 } // namespace
 
-SPH::SPH(const std::function<float(float, float, float)>* obstacle)
+SPH::SPH(const Obstacle& obstacle, bool cacheObstacle)
+    : SPH(std::vector<Obstacle>{obstacle}, cacheObstacle)
+{
+}
+
+SPH::SPH(const std::vector<Obstacle>& obstacles, bool cacheObstacles)
+    : SPH()
+{
+    setObstacles(obstacles, cacheObstacles);
+}
+
+SPH::SPH(const std::function<float(float, float, float)>* obstacle, bool cacheObstacle)
     : particles(Config::ParticlesNumber)
     , m_volume(SPHAlgorithms::Volume(
           SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), Config::CubeSize, Config::CubeSize, Config::CubeSize)))
     , m_searcher(SPHAlgorithms::NeighboursSearch3D<ParticleVect>(m_volume, Config::WaterSupportRadius, 0.001))
-    , m_obstacle(obstacle)
+    , m_obstaclesChanged(false)
+    , m_solver(new ExplicitSolver())
+    , m_time(0.)
+    , m_frameEndTime(0.)
+    , m_neighboursSkin(0.)
+    , m_boundarySpacing(0.)
 {
+    // most particles stay in their boxes during the step
+    m_searcher.setIncremental(true);
+
+    // the bounds of the equation are unknown, so the whole volume is tested
+    if (obstacle != nullptr)
+        setObstacles({Obstacle(*obstacle, m_volume.getBoundingCuboid())}, cacheObstacle);
+
     // set initial particle data
     double r = 2 * Config::ParticleRadius;
     double fi = 0.;
@@ -75,14 +96,238 @@ SPH::SPH(const std::function<float(float, float, float)>* obstacle)
     }
 }
 
+void SPH::setObstacles(const std::vector<Obstacle>& obstacles, bool cacheObstacles)
+{
+    m_obstacles = obstacles;
+
+    for (const Obstacle& obstacle : m_obstacles)
+    {
+        if (cacheObstacles)
+        {
+            // the field is sampled in the local space, so it is reused while the obstacle moves. It covers
+            // the obstacle with the margin for the penetration depth and the interpolation, clipped by
+            // the volume in the initial placement of the obstacle
+            const SPHAlgorithms::Cuboid fieldCuboid = SPHAlgorithms::intersectCuboids(
+                SPHAlgorithms::expandCuboid(obstacle.getLocalBoundingCuboid(),
+                                            Config::ParticleRadius + 2. * Config::ObstacleFieldCellSize),
+                obstacle.getTransform().toLocal(m_volume.getBoundingCuboid()));
+
+            m_obstacleFields.emplace_back(obstacle.getEquation(), fieldCuboid, Config::ObstacleFieldCellSize);
+        }
+    }
+
+    indexObstacles();
+}
+
+void SPH::indexObstacles()
+{
+    std::vector<SPHAlgorithms::Cuboid> obstacleBounds;
+
+    for (const Obstacle& obstacle : m_obstacles)
+        obstacleBounds.push_back(obstacle.getBoundingCuboid());
+
+    // the boxes of the points are found by the last search, the points moved by less than the radius since it
+    // are still found since the cuboids are expanded by one box
+    m_obstacleIndex = ObstacleIndex(m_searcher, obstacleBounds, Config::ParticleRadius);
+    m_obstaclesChanged = false;
+}
+
+Obstacle& SPH::getObstacle(size_t index)
+{
+    // the placement may be changed without the velocities, so the boxes are found again
+    m_obstaclesChanged = true;
+
+    return m_obstacles[index];
+}
+
+const Obstacle& SPH::getObstacle(size_t index) const
+{
+    return m_obstacles[index];
+}
+
+void SPH::setSolver(std::unique_ptr<Solver> solver)
+{
+    m_solver = std::move(solver);
+    m_solver->setBoundary(m_boundary.get());
+    m_solver->setPeriodicity(m_periodicity);
+    m_solver->initialize(particles);
+}
+
+Solver& SPH::getSolver()
+{
+    return *m_solver;
+}
+
+double SPH::getTime() const
+{
+    return m_time;
+}
+
+void SPH::setNeighboursSkin(double skin)
+{
+    m_neighboursSkin = skin;
+
+    m_searcher = SPHAlgorithms::NeighboursSearch3D<ParticleVect>(
+        m_volume, Config::WaterSupportRadius + m_neighboursSkin, 0.001);
+    m_searcher.setIncremental(true);
+    m_searcher.setPeriodicity(m_periodicity);
+
+    if (m_boundary)
+        m_boundary->setStaticPoints(m_searcher);
+
+    // the boxes are changed
+    indexObstacles();
+    m_searchPositions.clear();
+}
+
+void SPH::setBoundaryParticles(double spacing)
+{
+    m_boundary.reset();
+    m_boundarySpacing = spacing;
+
+    if (spacing > 0.)
+    {
+        std::vector<Obstacle> staticObstacles;
+
+        for (const Obstacle& obstacle : m_obstacles)
+        {
+            if (!obstacle.isMoving())
+                staticObstacles.push_back(obstacle);
+        }
+
+        m_boundary.reset(
+            new Boundary(m_volume, staticObstacles, spacing, Config::WaterSupportRadius, m_periodicity));
+        m_boundary->setStaticPoints(m_searcher);
+    }
+    else
+    {
+        m_searcher.setStaticPoints(BoundaryParticleVect());
+    }
+
+    m_solver->setBoundary(m_boundary.get());
+
+    // the boundary neighbours are found by the next search
+    m_searchPositions.clear();
+}
+
+void SPH::setPeriodicAxes(bool x, bool y, bool z)
+{
+    m_periodicity = SPHAlgorithms::Periodicity(m_volume.getBoundingCuboid(), x, y, z);
+    m_searcher.setPeriodicity(m_periodicity);
+    m_solver->setPeriodicity(m_periodicity);
+
+    // the faces of the periodic axes are open now
+    if (m_boundary)
+        setBoundaryParticles(m_boundarySpacing);
+
+    m_searchPositions.clear();
+}
+
+const Boundary* SPH::getBoundary() const
+{
+    return m_boundary.get();
+}
+
 void SPH::run()
 {
-    m_searcher.search(particles);
+    updateNeighbours();
+    makeStep();
+}
+
+FrameStatistics SPH::advance(double frameTime)
+{
+    FrameStatistics statistics;
+
+    m_frameEndTime += frameTime;
+
+    while (m_time < m_frameEndTime)
+    {
+        if (updateNeighbours())
+            statistics.searchesNumber++;
+
+        makeStep();
+        statistics.stepsNumber++;
+    }
+
+    return statistics;
+}
+
+bool SPH::updateNeighbours()
+{
+    bool isValid = m_neighboursSkin > 0. && m_searchPositions.size() == particles.size();
+
+    // the pair within the support radius now was within it plus the skin at the search
+    const double maxDisplacementSqr = 0.25 * m_neighboursSkin * m_neighboursSkin;
+
+    for (size_t i = 0; isValid && i < particles.size(); i++)
+    {
+        const SPHAlgorithms::Point3D displacement =
+            m_periodicity.calcMinimumImage(particles[i].position - m_searchPositions[i]);
+        isValid = displacement.calcNormSqr() <= maxDisplacementSqr;
+    }
+
+    if (isValid)
+        return false;
+
+    if (m_boundary)
+        m_boundary->findNeighbours(particles, m_searcher);
+    else
+        m_searcher.search(particles);
+
+    if (m_neighboursSkin > 0.)
+    {
+        m_searchPositions.resize(particles.size());
+
+        for (size_t i = 0; i < particles.size(); i++)
+            m_searchPositions[i] = particles[i].position;
+    }
+
+    return true;
+}
+
+double SPH::makeStep()
+{
+    const double timeStep = m_solver->step(particles);
+    m_time += timeStep;
 
-    Forces::ComputeAllForces(particles);
-    Integrator::integrate(0.01, particles);
+    if (m_obstacles.empty())
+    {
+        Collision::detectCollisions(particles, m_volume, nullptr, m_periodicity);
+        return timeStep;
+    }
+
+    if (m_obstaclesChanged)
+        indexObstacles();
+
+    const SPHAlgorithms::VectorOfSizetVectors obstacleCandidates = m_obstacleIndex.findCandidates(m_searcher);
+
+    if (!m_obstacleFields.empty())
+        Collision::detectCollisions(particles, m_volume, m_obstacles, m_obstacleFields, obstacleCandidates,
+                                    m_periodicity);
+    else
+        Collision::detectCollisions(particles, m_volume, m_obstacles, obstacleCandidates, m_periodicity);
+
+    moveObstacles(timeStep);
+
+    return timeStep;
+}
+
+void SPH::moveObstacles(double dt)
+{
+    bool moved = false;
+
+    for (Obstacle& obstacle : m_obstacles)
+    {
+        if (obstacle.isMoving())
+        {
+            obstacle.move(dt);
+            moved = true;
+        }
+    }
 
-    Collision::detectCollisions(particles, m_volume, m_obstacle);
+    // the boxes covered by the obstacles are changed
+    if (moved)
+        indexObstacles();
 }
 
 } // namespace SPHSDK
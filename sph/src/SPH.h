@@ -7,33 +7,170 @@
 #ifndef SPH_H_73C34465A6ED4DB9B9F2F4C3937BF5DC
 #define SPH_H_73C34465A6ED4DB9B9F2F4C3937BF5DC
 
+#include "Boundary.h"
+#include "Obstacle.h"
+#include "ObstacleIndex.h"
 #include "Particle.h"
+#include "Solver.h"
 
 #include "algorithms/src/Area.h"
 #include "algorithms/src/Defines.h"
+#include "algorithms/src/DistanceField.h"
 #include "algorithms/src/NeighboursSearch.h"
+#include "algorithms/src/Periodicity.h"
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 namespace SPHSDK
 {
 
+/**
+ * @brief FrameStatistics describes the steps made by SPH::advance.
+ */
+struct FrameStatistics
+{
+    size_t stepsNumber = 0u;
+
+    size_t searchesNumber = 0u; // the steps which searched the neighbours, the others reused them
+};
+
 class SPH
 {
 public:
-    SPH(const std::function<float(float, float, float)>* obstacle = nullptr);
+    /**
+     * @param obstacle         The obstacle equation, > 0 inside the obstacle
+     * @param cacheObstacle    Samples the obstacle into a distance field once, so collisions use
+     *                         interpolated values and surface normals instead of the equation
+     */
+    SPH(const std::function<float(float, float, float)>* obstacle = nullptr, bool cacheObstacle = false);
 
+    /**
+     * @brief Only the particles near the bounding cuboid of the obstacle are tested for collisions with it.
+     * @param obstacle         The obstacle with its bounds
+     * @param cacheObstacle    Samples the obstacle into a distance field over its bounds once
+     */
+    explicit SPH(const Obstacle& obstacle, bool cacheObstacle = false);
+
+    /**
+     * @brief The obstacles are indexed by the boxes of the neighbours search, so every particle is tested
+     * only against the obstacles near it.
+     * @param obstacles         The obstacles with their bounds
+     * @param cacheObstacles    Samples every obstacle into a distance field over its bounds once
+     */
+    explicit SPH(const std::vector<Obstacle>& obstacles, bool cacheObstacles = false);
+
+    /**
+     * @brief Makes one step of the solver, the explicit solver with the fixed time step by default.
+     */
     void run();
 
+    /**
+     * @brief Makes as many steps of the solver as it takes to simulate the frame time, the solver chooses
+     * the time steps. The steps do not end exactly at the frame, the last one may overrun it, and the next frame
+     * ends at its own time, so the simulated time follows the frames.
+     */
+    FrameStatistics advance(double frameTime);
+
+    /**
+     * @brief The neighbours are searched within the support radius increased by the skin, so the lists stay
+     * valid while every particle moves less than half the skin since the search, and the steps reuse them.
+     * The solvers skip the neighbours beyond the support radius. The skin 0 searches before every step.
+     */
+    void setNeighboursSkin(double skin);
+
+    /**
+     * @brief Samples the walls of the volume and the obstacles which do not move by the boundary particles, so
+     * the fluid near them has complete kernels. The solver adds the density and the forces of the boundary
+     * particles, the collisions still keep the particles inside of the walls. The obstacles are sampled in their
+     * current placement, the moving obstacles are left to the collisions. The spacing 0 removes the boundary.
+     */
+    void setBoundaryParticles(double spacing = Config::BoundaryParticleSpacing);
+
+    /**
+     * @brief Makes the axes of the volume cuboid periodic: the particles leaving through a face enter through
+     * the opposite one, and the particles near the opposite faces are neighbours. The periodicity is handed over
+     * to the solver, the boundary and the collisions, the faces of the periodic axes are not sampled by the boundary.
+     * The neighbours search needs at least one box along the periodic axis, so the volume must have no domain.
+     */
+    void setPeriodicAxes(bool x, bool y, bool z);
+
+    /**
+     * @brief Returns the boundary particles, nullptr if they are not set.
+     */
+    const Boundary* getBoundary() const;
+
+    /**
+     * @brief Replaces the solver, it is initialized with the current particles.
+     */
+    void setSolver(std::unique_ptr<Solver> solver);
+
+    Solver& getSolver();
+
+    /**
+     * @brief Returns the simulated time, the sum of the time steps taken by the solver.
+     */
+    double getTime() const;
+
+    /**
+     * @brief Gives access to the obstacle to change its placement or velocities between the steps, the obstacles
+     * are indexed again before the next collisions.
+     */
+    Obstacle& getObstacle(size_t index);
+
+    const Obstacle& getObstacle(size_t index) const;
+
+private:
+    void setObstacles(const std::vector<Obstacle>& obstacles, bool cacheObstacles);
+
+    /**
+     * @brief Searches the neighbours if some particle moved by more than half the skin since the last search.
+     * @return true if the neighbours were searched
+     */
+    bool updateNeighbours();
+
+    /**
+     * @brief Makes one step of the solver on the current neighbours with the collisions and the obstacles moved.
+     * @return The time step taken
+     */
+    double makeStep();
+
+    void indexObstacles();
+
+    void moveObstacles(double dt);
+
 public:
     ParticleVect particles;
 
 private:
     SPHAlgorithms::Volume m_volume;
 
+    SPHAlgorithms::Periodicity m_periodicity; // the periodic axes of the bounding cuboid of the volume
+
     SPHAlgorithms::NeighboursSearch3D<ParticleVect> m_searcher;
 
-    const std::function<float(float, float, float)>* m_obstacle;
+    std::vector<Obstacle> m_obstacles;
+
+    std::vector<SPHAlgorithms::DistanceField> m_obstacleFields;
+
+    ObstacleIndex m_obstacleIndex;
+
+    bool m_obstaclesChanged; // the obstacles were given out for changes since they were indexed
+
+    std::unique_ptr<Solver> m_solver;
+
+    std::unique_ptr<Boundary> m_boundary;
+
+    double m_time;
+
+    double m_frameEndTime;
+
+    double m_neighboursSkin;
+
+    double m_boundarySpacing;
+
+    std::vector<SPHAlgorithms::Point3D> m_searchPositions; // the positions of the particles at the last search
 };
 
 } // namespace SPHSDK
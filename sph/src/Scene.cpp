@@ -0,0 +1,46 @@
+/**
+ * @file Scene.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Scene.h"
+
+#include <cmath>
+
+namespace SPHSDK
+{
+namespace Scene
+{
+
+double calcRestSpacing()
+{
+    return std::cbrt(Config::WaterParticleMass / Config::WaterDensity);
+}
+
+ParticleVect createBlock(const SPHAlgorithms::Cuboid& block, double spacing)
+{
+    const size_t xNumber = static_cast<size_t>(block.width / spacing);
+    const size_t yNumber = static_cast<size_t>(block.length / spacing);
+    const size_t zNumber = static_cast<size_t>(block.height / spacing);
+
+    ParticleVect particles;
+    particles.reserve(xNumber * yNumber * zNumber);
+
+    for (size_t iZ = 0; iZ < zNumber; iZ++)
+        for (size_t iY = 0; iY < yNumber; iY++)
+            for (size_t iX = 0; iX < xNumber; iX++)
+            {
+                particles.push_back(Particle(block.startingPoint + SPHAlgorithms::Point3D(spacing * (iX + 0.5),
+                                                                                          spacing * (iY + 0.5),
+                                                                                          spacing * (iZ + 0.5))));
+                particles.back().previous_position = particles.back().position;
+                particles.back().velocity = Config::InitialVelocity;
+                particles.back().mass = Config::WaterParticleMass;
+            }
+
+    return particles;
+}
+
+} // namespace Scene
+} // namespace SPHSDK
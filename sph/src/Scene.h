@@ -0,0 +1,40 @@
+/**
+ * @file Scene.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef SCENE_H_004891E096CD472BB853C85D1EAEABE8
+#define SCENE_H_004891E096CD472BB853C85D1EAEABE8
+
+#include "Particle.h"
+
+#include "algorithms/src/Area.h"
+
+namespace SPHSDK
+{
+
+/**
+ * @brief Scene functions create the initial particles of the typical scenarios, e.g. the water column of
+ * the dam break.
+ */
+namespace Scene
+{
+
+/**
+ * @brief Returns the spacing of the cubic lattice where the particles of Config::WaterParticleMass have
+ * Config::WaterDensity.
+ */
+double calcRestSpacing();
+
+/**
+ * @brief Fills the cuboid with the particles at rest on the cubic lattice, the lattice starts half of the spacing
+ * away from the corner of the cuboid.
+ */
+ParticleVect createBlock(const SPHAlgorithms::Cuboid& block, double spacing = calcRestSpacing());
+
+} // namespace Scene
+
+} // namespace SPHSDK
+
+#endif // SCENE_H_004891E096CD472BB853C85D1EAEABE8
@@ -0,0 +1,102 @@
+/**
+ * @file Solver.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "Solver.h"
+
+#include "Boundary.h"
+#include "Forces.h"
+#include "Integrator.h"
+
+#include <algorithm>
+
+namespace SPHSDK
+{
+
+double Solver::calcCourantTimeStep(const ParticleVect& particles)
+{
+    double timeStep = Config::MaxTimeStep;
+
+    for (const auto& particle : particles)
+    {
+        const double speed = particle.velocity.calcNorm();
+        if (speed > 0.)
+            timeStep = std::min(timeStep, Config::CourantNumber * particle.supportRadius / speed);
+    }
+
+    return timeStep;
+}
+
+void Solver::setBoundary(Boundary* boundary)
+{
+    m_boundary = boundary;
+}
+
+void Solver::setPeriodicity(const SPHAlgorithms::Periodicity& periodicity)
+{
+    m_periodicity = periodicity;
+}
+
+template <class Scheme, class Kernel>
+ExplicitSolverT<Scheme, Kernel>::ExplicitSolverT(double timeStep)
+    : m_timeStep(timeStep)
+{
+}
+
+template <class Scheme, class Kernel> double ExplicitSolverT<Scheme, Kernel>::step(ParticleVect& particles)
+{
+    using KernelForces = ForcesT<double, Kernel>;
+
+    for (size_t stage = 0; stage < Scheme::StagesNumber; stage++)
+    {
+        if (m_boundary == nullptr)
+        {
+            KernelForces::ComputeAllForces(particles, m_periodicity);
+        }
+        else
+        {
+            KernelForces::ComputeDensity(particles, m_periodicity);
+            m_boundary->addDensity<Kernel>(particles);
+            KernelForces::ComputePressure(particles);
+            KernelForces::ComputeForces(particles, m_periodicity);
+            m_boundary->addForces<Kernel>(particles);
+        }
+
+        Integrator::integrateStage<Scheme>(stage, m_timeStep, particles);
+    }
+
+    return m_timeStep;
+}
+
+template <class Scheme, class Kernel> void ExplicitSolverT<Scheme, Kernel>::setBoundary(Boundary* boundary)
+{
+    Solver::setBoundary(boundary);
+
+    if (boundary != nullptr)
+        boundary->computeVolumes<Kernel>();
+}
+
+template class ExplicitSolverT<VerletScheme, MullerKernel<double>>;
+template class ExplicitSolverT<VerletScheme, TabulatedMullerKernel<double>>;
+template class ExplicitSolverT<VerletScheme, CubicSplineKernel<double>>;
+template class ExplicitSolverT<VerletScheme, WendlandC2Kernel<double>>;
+template class ExplicitSolverT<VerletScheme, WendlandC4Kernel<double>>;
+template class ExplicitSolverT<LeapfrogScheme, MullerKernel<double>>;
+template class ExplicitSolverT<LeapfrogScheme, TabulatedMullerKernel<double>>;
+template class ExplicitSolverT<LeapfrogScheme, CubicSplineKernel<double>>;
+template class ExplicitSolverT<LeapfrogScheme, WendlandC2Kernel<double>>;
+template class ExplicitSolverT<LeapfrogScheme, WendlandC4Kernel<double>>;
+template class ExplicitSolverT<SymplecticEulerScheme, MullerKernel<double>>;
+template class ExplicitSolverT<SymplecticEulerScheme, TabulatedMullerKernel<double>>;
+template class ExplicitSolverT<SymplecticEulerScheme, CubicSplineKernel<double>>;
+template class ExplicitSolverT<SymplecticEulerScheme, WendlandC2Kernel<double>>;
+template class ExplicitSolverT<SymplecticEulerScheme, WendlandC4Kernel<double>>;
+template class ExplicitSolverT<MidpointScheme, MullerKernel<double>>;
+template class ExplicitSolverT<MidpointScheme, TabulatedMullerKernel<double>>;
+template class ExplicitSolverT<MidpointScheme, CubicSplineKernel<double>>;
+template class ExplicitSolverT<MidpointScheme, WendlandC2Kernel<double>>;
+template class ExplicitSolverT<MidpointScheme, WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
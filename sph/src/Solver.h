@@ -0,0 +1,92 @@
+/**
+ * @file Solver.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef SOLVER_H_B5EFD1E1F7604909B84E771DE45EBDA1
+#define SOLVER_H_B5EFD1E1F7604909B84E771DE45EBDA1
+
+#include "Integrator.h"
+#include "Kernels.h"
+#include "Particle.h"
+
+namespace SPHSDK
+{
+
+class Boundary;
+
+/**
+ * @brief Solver is the strategy of one step of SPH: it computes the forces and integrates the particles.
+ * The neighbours of the particles are found by SPH before the step and the collisions are detected after it,
+ * so the solver only works on the neighbour lists.
+ */
+class Solver
+{
+public:
+    virtual ~Solver() = default;
+
+    /**
+     * @brief Prepares the state of the particles before the first step, e.g. the rest density.
+     */
+    virtual void initialize(ParticleVect& /*particles*/)
+    {
+    }
+
+    /**
+     * @brief Advances the particles by one step.
+     * @return The time step taken
+     */
+    virtual double step(ParticleVect& particles) = 0;
+
+    /**
+     * @brief Sets the boundary particles of the walls, their neighbours are found by SPH together with the fluid
+     * neighbours. The explicit and the weakly compressible solvers add their density and forces, the other
+     * solvers leave the walls to the collisions. nullptr removes the boundary.
+     * The solvers adding the walls compute the volumes of the boundary particles by their kernel.
+     */
+    virtual void setBoundary(Boundary* boundary);
+
+    /**
+     * @brief Sets the periodic axes of the domain, the differences of the positions of the neighbours across
+     * them are taken between the nearest images. SPH sets them together with the ones of the neighbour search.
+     */
+    void setPeriodicity(const SPHAlgorithms::Periodicity& periodicity);
+
+protected:
+    /**
+     * @brief Returns the time step the fastest particle moves by the part Config::CourantNumber of its support
+     * radius in, but not more than Config::MaxTimeStep.
+     */
+    static double calcCourantTimeStep(const ParticleVect& particles);
+
+    const Boundary* m_boundary = nullptr;
+
+    SPHAlgorithms::Periodicity m_periodicity;
+};
+
+/**
+ * @brief ExplicitSolverT is the original pipeline: the density by summation, the linear equation of state and
+ * the fixed time step with the speed limit of the integrator. The scheme policy of Integrator.h integrates
+ * the particles, the forces of every stage of it are computed over the neighbour lists of the step by the kernel
+ * policy of Kernels.h. It is instantiated for the schemes of Integrator.h with MullerKernel,
+ * TabulatedMullerKernel, CubicSplineKernel, WendlandC2Kernel and WendlandC4Kernel of double only.
+ */
+template <class Scheme, class Kernel = MullerKernel<double>> class ExplicitSolverT : public Solver
+{
+public:
+    explicit ExplicitSolverT(double timeStep = 0.01);
+
+    double step(ParticleVect& particles) override;
+
+    void setBoundary(Boundary* boundary) override;
+
+private:
+    double m_timeStep;
+};
+
+using ExplicitSolver = ExplicitSolverT<VerletScheme>;
+
+} // namespace SPHSDK
+
+#endif // SOLVER_H_B5EFD1E1F7604909B84E771DE45EBDA1
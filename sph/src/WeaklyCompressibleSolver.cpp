@@ -0,0 +1,150 @@
+/**
+ * @file WeaklyCompressibleSolver.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "WeaklyCompressibleSolver.h"
+
+#include "Boundary.h"
+#include "Forces.h"
+#include "Integrator.h"
+#include "Kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPHSDK
+{
+
+template <class Kernel>
+WeaklyCompressibleSolverT<Kernel>::WeaklyCompressibleSolverT(bool densityDiffusion, double soundSpeed)
+    : m_densityDiffusion(densityDiffusion)
+    , m_soundSpeed(soundSpeed)
+{
+}
+
+template <class Kernel> void WeaklyCompressibleSolverT<Kernel>::initialize(ParticleVect& particles)
+{
+    for (auto& particle : particles)
+        particle.density = Config::WaterDensity;
+}
+
+template <class Kernel> double WeaklyCompressibleSolverT<Kernel>::step(ParticleVect& particles)
+{
+    computeDensityRates(particles);
+    computePressure(particles);
+
+    ForcesT<double, Kernel>::ComputeForces(particles, m_periodicity);
+
+    if (m_boundary != nullptr)
+        m_boundary->addForces<Kernel>(particles);
+
+    const double timeStep = calcTimeStep(particles);
+
+    for (size_t i = 0; i < particles.size(); i++)
+        particles[i].density += m_densityRates[i] * timeStep;
+
+    Integrator::integrate(timeStep, particles, false);
+
+    return timeStep;
+}
+
+template <class Kernel> void WeaklyCompressibleSolverT<Kernel>::setBoundary(Boundary* boundary)
+{
+    Solver::setBoundary(boundary);
+
+    if (boundary != nullptr)
+        boundary->computeVolumes<Kernel>();
+}
+
+template <class Kernel> double WeaklyCompressibleSolverT<Kernel>::calcTimeStep(const ParticleVect& particles) const
+{
+    double timeStep = Config::MaxTimeStep;
+
+    for (const auto& particle : particles)
+        timeStep = std::min(timeStep, calcParticleTimeStep(particle));
+
+    return timeStep;
+}
+
+template <class Kernel> double WeaklyCompressibleSolverT<Kernel>::calcParticleTimeStep(const Particle& particle) const
+{
+    const double signalSpeed = m_soundSpeed + particle.velocity.calcNorm();
+    double timeStep = std::min(Config::MaxTimeStep, Config::CourantNumber * particle.supportRadius / signalSpeed);
+
+    const double force = particle.fTotal.calcNorm();
+    if (force > 0. && particle.density > 0.)
+        timeStep = std::min(timeStep, 0.25 * std::sqrt(particle.supportRadius * particle.density / force));
+
+    return timeStep;
+}
+
+template <class Kernel> void WeaklyCompressibleSolverT<Kernel>::computeDensityRates(const ParticleVect& particles)
+{
+    m_densityRates.resize(particles.size());
+
+    for (size_t i = 0; i < particles.size(); i++)
+        m_densityRates[i] = calcDensityRate(particles, i);
+}
+
+template <class Kernel>
+double WeaklyCompressibleSolverT<Kernel>::calcDensityRate(const ParticleVect& particles, size_t i) const
+{
+    const double mass = Config::WaterParticleMass;
+
+    // delta * c0 of the diffusion term with the factor 2 of psi_ij
+    const double diffusion = m_densityDiffusion ? 2. * Config::DensityDiffusionCoefficient * m_soundSpeed : 0.;
+
+    double densityRate = 0.;
+
+    for (const size_t neighbourIndex : particles[i].neighbours)
+    {
+        const Particle& neighbour = particles[neighbourIndex];
+
+        const SPHAlgorithms::Point3D differenceParticleNeighbour =
+            calcDifference(particles[i], neighbour, m_periodicity);
+        const double distanceSqr = differenceParticleNeighbour.calcNormSqr();
+        const double supportRadius = symmetrizedSupportRadius(particles[i].supportRadius, neighbour.supportRadius);
+
+        if (distanceSqr <= 0. || distanceSqr >= supportRadius * supportRadius)
+            continue;
+
+        const SPHAlgorithms::Point3D gradient = Kernel::pressureGradient(differenceParticleNeighbour, supportRadius);
+
+        // the continuity equation d(rho_i)/dt = sum m_j (v_i - v_j) . grad W_ij
+        densityRate += mass * SPHAlgorithms::calcDotProduct(particles[i].velocity - neighbour.velocity, gradient);
+
+        // delta-SPH: delta * h * c0 * sum psi_ij . grad W_ij * m_j / rho_j with
+        // psi_ij = 2 * (rho_j - rho_i) * (x_j - x_i) / |x_j - x_i|^2, it moves the density to the average of
+        // the neighbours
+        densityRate += diffusion * supportRadius * (neighbour.density - particles[i].density) *
+                       -SPHAlgorithms::calcDotProduct(differenceParticleNeighbour, gradient) / distanceSqr * mass /
+                       neighbour.density;
+    }
+
+    if (m_boundary != nullptr)
+        densityRate += m_boundary->calcDensityRate<Kernel>(particles, i);
+
+    return densityRate;
+}
+
+template <class Kernel> void WeaklyCompressibleSolverT<Kernel>::computePressure(ParticleVect& particles) const
+{
+    const double stiffness = Config::WaterDensity * m_soundSpeed * m_soundSpeed / Config::TaitExponent;
+
+    for (auto& particle : particles)
+    {
+        // the negative pressure near the free surface would pull the particles into clumps
+        particle.pressure =
+            std::max(0., stiffness * (std::pow(particle.density / Config::WaterDensity, Config::TaitExponent) - 1.));
+    }
+}
+
+template class WeaklyCompressibleSolverT<MullerKernel<double>>;
+template class WeaklyCompressibleSolverT<TabulatedMullerKernel<double>>;
+template class WeaklyCompressibleSolverT<CubicSplineKernel<double>>;
+template class WeaklyCompressibleSolverT<WendlandC2Kernel<double>>;
+template class WeaklyCompressibleSolverT<WendlandC4Kernel<double>>;
+
+} // namespace SPHSDK
@@ -0,0 +1,87 @@
+/**
+ * @file WeaklyCompressibleSolver.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef WEAKLY_COMPRESSIBLE_SOLVER_H_F45F4C2837B5414D874DD4B716D073F3
+#define WEAKLY_COMPRESSIBLE_SOLVER_H_F45F4C2837B5414D874DD4B716D073F3
+
+#include "Config.h"
+#include "Kernels.h"
+#include "Solver.h"
+
+#include <vector>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+class WeaklyCompressibleSolverTestSuite;
+} // namespace TestEnvironment
+
+/**
+ * @brief WeaklyCompressibleSolverT is WCSPH: the density is integrated by the continuity equation and the pressure
+ * is given by the Tait equation p = rho0 * c0^2 / gamma * ((rho / rho0)^gamma - 1). The stiff equation keeps
+ * the density within ~1% of the rest density, and the time step follows the CFL condition of the speed of sound,
+ * so the speed limit of the integrator is not used.
+ * The kernel policy of Kernels.h is used by the forces, the continuity equation and the boundary, it is
+ * instantiated for MullerKernel, TabulatedMullerKernel, CubicSplineKernel, WendlandC2Kernel and WendlandC4Kernel
+ * of double only.
+ */
+template <class Kernel> class WeaklyCompressibleSolverT : public Solver
+{
+    friend class TestEnvironment::WeaklyCompressibleSolverTestSuite;
+
+public:
+    /**
+     * @param densityDiffusion    Adds the delta-SPH diffusion term to the continuity equation, it smooths out
+     *                            the noise of the density and so of the pressure
+     * @param soundSpeed          The numerical speed of sound c0
+     */
+    explicit WeaklyCompressibleSolverT(bool densityDiffusion = true, double soundSpeed = Config::WaterSoundSpeed);
+
+    /**
+     * @brief The fluid starts at rest, so every particle gets the rest density.
+     */
+    void initialize(ParticleVect& particles) override;
+
+    double step(ParticleVect& particles) override;
+
+    void setBoundary(Boundary* boundary) override;
+
+    /**
+     * @brief Returns the stable time step for the velocities and the forces of the particles:
+     * min(CourantNumber * h / (c0 + |v|), 0.25 * sqrt(h / |a|)), but not more than Config::MaxTimeStep.
+     */
+    double calcTimeStep(const ParticleVect& particles) const;
+
+protected:
+    /**
+     * @brief Returns the stable time step of the particle, calcTimeStep() is the minimum over the particles.
+     */
+    double calcParticleTimeStep(const Particle& particle) const;
+
+    void computeDensityRates(const ParticleVect& particles);
+
+    /**
+     * @brief Returns the rate of the density of the particle by the continuity equation.
+     */
+    double calcDensityRate(const ParticleVect& particles, size_t i) const;
+
+    void computePressure(ParticleVect& particles) const;
+
+    std::vector<double> m_densityRates;
+
+private:
+    bool m_densityDiffusion;
+
+    double m_soundSpeed;
+};
+
+using WeaklyCompressibleSolver = WeaklyCompressibleSolverT<MullerKernel<double>>;
+
+} // namespace SPHSDK
+
+#endif // WEAKLY_COMPRESSIBLE_SOLVER_H_F45F4C2837B5414D874DD4B716D073F3
@@ -0,0 +1,240 @@
+/**
+ * @file BoundaryTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "BoundaryTestSuite.h"
+
+#include "Boundary.h"
+#include "Forces.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const SPHAlgorithms::Volume UnitVolume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+
+void BoundaryTestSuite::samplesCuboidFaces()
+{
+    const Boundary boundary(UnitVolume, {}, 0.05);
+
+    // the lattice of 21 points along every axis without its inner 19 x 19 x 19 points
+    ASSERT_EQ(21u * 21u * 21u - 19u * 19u * 19u, boundary.getParticles().size());
+
+    double faceVolume = 0.;
+    double edgeVolume = 0.;
+    double cornerVolume = 0.;
+
+    for (const BoundaryParticle& particle : boundary.getParticles())
+    {
+        const SPHAlgorithms::Point3D& position = particle.position;
+
+        size_t facesNumber = 0u;
+        for (const double coordinate : {position.x, position.y, position.z})
+        {
+            if (coordinate < 1e-9 || coordinate > 1. - 1e-9)
+                facesNumber++;
+        }
+
+        ASSERT_LE(1u, facesNumber);
+
+        if (std::abs(position.x - 0.5) < 1e-9 && std::abs(position.y - 0.5) < 1e-9 && position.z < 1e-9)
+            faceVolume = particle.volume;
+        if (std::abs(position.x - 0.5) < 1e-9 && position.y < 1e-9 && position.z < 1e-9)
+            edgeVolume = particle.volume;
+        if (position.x < 1e-9 && position.y < 1e-9 && position.z < 1e-9)
+            cornerVolume = particle.volume;
+    }
+
+    // the particles with fewer boundary neighbours have larger volumes, so the walls act evenly. The neighbours of
+    // the edge are two halves of the plane like the ones of the face, the corner has three quarters of the plane
+    EXPECT_LT(0., faceVolume);
+    EXPECT_NEAR(faceVolume, edgeVolume, 1e-9 * faceVolume);
+    EXPECT_LT(1.2 * faceVolume, cornerVolume);
+
+    // the boundary particles keep no neighbours
+    for (const BoundaryParticle& particle : boundary.getParticles())
+        EXPECT_TRUE(particle.neighbours.empty());
+}
+
+void BoundaryTestSuite::samplesObstacleSurface()
+{
+    using namespace SPHAlgorithms::ShapeExpressions;
+    const Obstacle obstacle(Sphere(SPHAlgorithms::Point3F(0.5f, 0.5f, 0.5f), 0.2f));
+
+    const Boundary walls(UnitVolume, {}, 0.05);
+    const Boundary boundary(UnitVolume, {obstacle}, 0.05);
+
+    ASSERT_LT(walls.getParticles().size(), boundary.getParticles().size());
+
+    // the obstacle particles are inside of the sphere within one diagonal of the lattice cell from its surface
+    for (size_t i = walls.getParticles().size(); i < boundary.getParticles().size(); i++)
+    {
+        const double distance =
+            (boundary.getParticles()[i].position - SPHAlgorithms::Point3D(0.5, 0.5, 0.5)).calcNorm();
+
+        EXPECT_GT(0.2, distance);
+        EXPECT_LT(0.2 - 0.05 * std::sqrt(3.), distance);
+    }
+}
+
+void BoundaryTestSuite::completesWallDensity()
+{
+    const double spacing = Scene::calcRestSpacing();
+
+    // the block stands on the floor of the volume
+    ParticleVect particles =
+        Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.3, 0.3, 0.), 0.4, 0.4, 0.4));
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(UnitVolume, Config::WaterSupportRadius, 0.001);
+    searcher.search(particles);
+
+    Forces::ComputeDensity(particles);
+
+    // the particles in the middle of the floor layer and of the block
+    size_t floorIndex = 0u;
+    size_t innerIndex = 0u;
+    const SPHAlgorithms::Point3D floorPoint(0.5, 0.5, 0.);
+    const SPHAlgorithms::Point3D innerPoint(0.5, 0.5, 0.2);
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        if ((particles[i].position - floorPoint).calcNormSqr() <
+            (particles[floorIndex].position - floorPoint).calcNormSqr())
+            floorIndex = i;
+
+        if ((particles[i].position - innerPoint).calcNormSqr() <
+            (particles[innerIndex].position - innerPoint).calcNormSqr())
+            innerIndex = i;
+    }
+
+    const double innerDensity = particles[innerIndex].density;
+    const double truncatedDensity = particles[floorIndex].density;
+
+    Boundary boundary(UnitVolume, {}, spacing);
+    boundary.setStaticPoints(searcher);
+    boundary.findNeighbours(particles, searcher);
+    boundary.addDensity(particles);
+
+    const double floorDensity = particles[floorIndex].density;
+
+    // the inner particle does not reach the walls
+    EXPECT_EQ(innerDensity, particles[innerIndex].density);
+    EXPECT_TRUE(boundary.getNeighbours(innerIndex).empty());
+
+    // the kernel of the floor particle misses the fluid below it, the boundary makes it up. The single layer
+    // of the boundary particles stands for the rest density of the whole wall, so the particle at the wall is
+    // denser and it is pushed to the distance where the densities match
+    EXPECT_GT(innerDensity, truncatedDensity);
+    EXPECT_LT(innerDensity, floorDensity);
+    EXPECT_GT(innerDensity + Config::WaterDensity, floorDensity);
+}
+
+void BoundaryTestSuite::wallPushesParticle()
+{
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.02))};
+    particles[0].density = Config::WaterDensity;
+    particles[0].pressure = 100.;
+    particles[0].velocity = SPHAlgorithms::Point3D(1., 0., 0.);
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(UnitVolume, Config::WaterSupportRadius, 0.001);
+
+    Boundary boundary(UnitVolume, {}, 0.03);
+    boundary.setStaticPoints(searcher);
+    boundary.findNeighbours(particles, searcher);
+    boundary.addForces(particles);
+
+    // the floor pushes the particle up and slows it down
+    EXPECT_LT(0., particles[0].fPressure.z);
+    EXPECT_NEAR(0., particles[0].fPressure.x, 1e-9 * particles[0].fPressure.z);
+    EXPECT_NEAR(0., particles[0].fPressure.y, 1e-9 * particles[0].fPressure.z);
+    EXPECT_GT(0., particles[0].fViscosity.x);
+    EXPECT_EQ(particles[0].fPressure + particles[0].fViscosity, particles[0].fTotal);
+
+    // the negative pressure does not pull the particle to the wall
+    particles[0].pressure = -100.;
+    particles[0].fPressure = SPHAlgorithms::Point3D();
+    boundary.addForces(particles);
+
+    EXPECT_EQ(SPHAlgorithms::Point3D(), particles[0].fPressure);
+}
+
+void BoundaryTestSuite::opensPeriodicFaces()
+{
+    const SPHAlgorithms::Periodicity periodicity(UnitVolume.getBoundingCuboid(), true, true, false);
+    const Boundary boundary(UnitVolume, {}, 0.05, Config::WaterSupportRadius, periodicity);
+
+    // only the floor and the ceiling are sampled, the periodic axes have no walls and no end points
+    ASSERT_EQ(2u * 20u * 20u, boundary.getParticles().size());
+
+    for (const BoundaryParticle& particle : boundary.getParticles())
+    {
+        EXPECT_TRUE(particle.position.z < 1e-9 || particle.position.z > 1. - 1e-9);
+
+        // the neighbours across the periodic faces make the volumes even
+        EXPECT_NEAR(boundary.getParticles()[0].volume, particle.volume, 1e-9 * particle.volume);
+    }
+}
+
+void BoundaryTestSuite::samplesDomainAcrossPeriodicFaces()
+{
+    // the fluid is above the solid slab under z = 0.175, between the lattice points
+    const SPHAlgorithms::Cuboid cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.);
+    const SPHAlgorithms::Volume volume(cuboid, [](float, float, float z) { return z - 0.175f; }, 0.02);
+    const SPHAlgorithms::Periodicity periodicity(cuboid, true, true, false);
+
+    const Boundary boundary(volume, {}, 0.05, Config::WaterSupportRadius, periodicity);
+
+    // the slab continues across the periodic faces, so only its top, its bottom face and the ceiling are sampled
+    ASSERT_EQ(3u * 20u * 20u, boundary.getParticles().size());
+
+    for (const BoundaryParticle& particle : boundary.getParticles())
+    {
+        const double z = particle.position.z;
+
+        EXPECT_TRUE(z < 1e-9 || std::abs(z - 0.15) < 1e-9 || z > 1. - 1e-9);
+    }
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(BoundaryTestSuite, samplesCuboidFaces)
+{
+    BoundaryTestSuite::samplesCuboidFaces();
+}
+
+TEST(BoundaryTestSuite, samplesObstacleSurface)
+{
+    BoundaryTestSuite::samplesObstacleSurface();
+}
+
+TEST(BoundaryTestSuite, completesWallDensity)
+{
+    BoundaryTestSuite::completesWallDensity();
+}
+
+TEST(BoundaryTestSuite, wallPushesParticle)
+{
+    BoundaryTestSuite::wallPushesParticle();
+}
+
+TEST(BoundaryTestSuite, opensPeriodicFaces)
+{
+    BoundaryTestSuite::opensPeriodicFaces();
+}
+
+TEST(BoundaryTestSuite, samplesDomainAcrossPeriodicFaces)
+{
+    BoundaryTestSuite::samplesDomainAcrossPeriodicFaces();
+}
@@ -0,0 +1,33 @@
+/**
+ * @file BoundaryTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef BOUNDARY_TEST_SUITE_H_9E4B2C7A1F3D4E8B6A0C5D9F2B7E3A16
+#define BOUNDARY_TEST_SUITE_H_9E4B2C7A1F3D4E8B6A0C5D9F2B7E3A16
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class BoundaryTestSuite
+{
+public:
+    static void samplesCuboidFaces();
+
+    static void samplesObstacleSurface();
+
+    static void completesWallDensity();
+
+    static void wallPushesParticle();
+    static void opensPeriodicFaces();
+    static void samplesDomainAcrossPeriodicFaces();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // BOUNDARY_TEST_SUITE_H_9E4B2C7A1F3D4E8B6A0C5D9F2B7E3A16
@@ -7,7 +7,14 @@
 #include "CollisionsTestSuite.h"
 
 #include "Collisions.h"
+#include "Config.h"
+#include "Obstacle.h"
+#include "ObstacleIndex.h"
 #include "algorithms/src/Area.h"
+#include "algorithms/src/DistanceField.h"
+#include "algorithms/src/NeighboursSearch.h"
+#include "algorithms/src/RigidTransform.h"
+#include "algorithms/src/ShapeExpressions.h"
 
 #include <gtest/gtest.h>
 
@@ -139,7 +146,7 @@ void CollisionsTestSuite::twoAndTwoParticleCollision()
     particleVector[2].neighbours = {0, 1, 3};
     particleVector[3].neighbours = {0, 1, 2};
 
-    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 1.0), 4.0, 4.0, 1.0));
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 4.0, 4.0, 1.0));
 
     Collision::detectCollisions(particleVector, volume);
 
@@ -302,7 +309,7 @@ void CollisionsTestSuite::oneOnBoundaryParticleCollision()
 {
     ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(-9.83, -0.003716, -1.0), 0.1)};
     particleVector[0].velocity = SPHAlgorithms::Point3D(-0.5, -7.0, -1.0);
-    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, -1.0), 10.0, 10.0, 10.0));
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 10.0, 10.0, 10.0));
 
     Collision::detectCollisions(particleVector, volume);
 
@@ -360,6 +367,269 @@ void CollisionsTestSuite::threeOnBoundaryParticleCollision()
     EXPECT_DOUBLE_EQ(1.0, particleVector[2].velocity.z);
 }
 
+void CollisionsTestSuite::obstacleFieldCollision()
+{
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(1.45, 1.0, 1.0), 0.1),
+                                   Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.5), 0.1)};
+    particleVector[0].velocity = SPHAlgorithms::Point3D(-2.0, 1.0, 0.0);
+    particleVector[1].velocity = SPHAlgorithms::Point3D(-2.0, 1.0, 0.0);
+
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 2.0, 2.0, 2.0));
+
+    // sphere with radius 0.5 in the center of the volume
+    const auto sphere = [](float x, float y, float z) {
+        return 0.25f - (x - 1.f) * (x - 1.f) - (y - 1.f) * (y - 1.f) - (z - 1.f) * (z - 1.f);
+    };
+    const SPHAlgorithms::DistanceField obstacleField(sphere, volume.getBoundingCuboid(), 0.02);
+
+    Collision::detectCollisions(particleVector, volume, obstacleField);
+
+    // the particle is pushed out by the approximate penetration depth along the normal
+    EXPECT_NEAR(1.6, particleVector[0].position.x, 5e-3);
+    EXPECT_NEAR(1.0, particleVector[0].position.y, 1e-3);
+    EXPECT_NEAR(1.0, particleVector[0].position.z, 1e-3);
+
+    // the normal velocity is reflected, the tangential one is kept
+    EXPECT_NEAR(1.0, particleVector[0].velocity.x, 1e-3);
+    EXPECT_NEAR(1.0, particleVector[0].velocity.y, 1e-3);
+    EXPECT_NEAR(0.0, particleVector[0].velocity.z, 1e-3);
+
+    EXPECT_DOUBLE_EQ(0.5, particleVector[1].position.x);
+    EXPECT_DOUBLE_EQ(-2.0, particleVector[1].velocity.x);
+}
+
+void CollisionsTestSuite::obstacleExpressionCollision()
+{
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(1.2, 1.0, 1.0), 0.1),
+                                   Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.5), 0.1)};
+    particleVector[0].previous_position = SPHAlgorithms::Point3D(1.6, 1.0, 1.0);
+    particleVector[0].velocity = SPHAlgorithms::Point3D(-2.0, 0.0, 0.0);
+    particleVector[1].velocity = SPHAlgorithms::Point3D(-2.0, 0.0, 0.0);
+
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 2.0, 2.0, 2.0));
+
+    // the sphere with radius 0.5 in the center of the volume cut by the plane x = 1.4
+    using namespace SPHAlgorithms::ShapeExpressions;
+    const auto obstacle = Sphere(SPHAlgorithms::Point3F(1.f, 1.f, 1.f), 0.5f) &
+                          HalfSpace(SPHAlgorithms::Point3F(1.f, 0.f, 0.f), 1.4f);
+
+    Collision::detectCollisions(particleVector, volume, obstacle);
+
+    // the particle inside of the obstacle is returned to its previous position
+    EXPECT_DOUBLE_EQ(1.6, particleVector[0].position.x);
+    EXPECT_DOUBLE_EQ(-2.0 * Config::CollisionVelocityMultiplier, particleVector[0].velocity.x);
+
+    EXPECT_DOUBLE_EQ(0.5, particleVector[1].position.x);
+    EXPECT_DOUBLE_EQ(-2.0, particleVector[1].velocity.x);
+}
+
+void CollisionsTestSuite::obstacleCulling()
+{
+    // the small obstacle on the floor of the large tank filled with particles
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 4.0, 4.0, 4.0));
+
+    ParticleVect particleVector;
+
+    for (size_t i = 0u; i < 20u; ++i)
+        for (size_t j = 0u; j < 20u; ++j)
+            for (size_t k = 0u; k < 20u; ++k)
+            {
+                particleVector.push_back(
+                    Particle(SPHAlgorithms::Point3D(0.1 + 0.2 * i, 0.1 + 0.2 * j, 0.1 + 0.2 * k), 0.01));
+                particleVector.back().previous_position = particleVector.back().position;
+            }
+
+    // the particle inside of the obstacle
+    const size_t inside = (10u * 20u + 10u) * 20u + 1u;
+    particleVector[inside].previous_position = SPHAlgorithms::Point3D(2.1, 2.1, 1.0);
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, 0.1, 0.001);
+    searcher.search(particleVector);
+
+    size_t evaluations = 0u;
+    const SPHAlgorithms::ShapeExpressions::Sphere sphere(SPHAlgorithms::Point3F(2.f, 2.f, 0.3f), 0.25f);
+    const Obstacle obstacle(
+        [&evaluations, &sphere](float x, float y, float z) {
+            ++evaluations;
+            return sphere(x, y, z);
+        },
+        sphere.bounds());
+
+    const SPHAlgorithms::SizetVector candidates =
+        searcher.findPointsNearCuboid(SPHAlgorithms::expandCuboid(obstacle.getBoundingCuboid(), 0.01));
+
+    Collision::detectCollisions(particleVector, volume, obstacle, candidates);
+
+    EXPECT_DOUBLE_EQ(1.0, particleVector[inside].position.z);
+
+    // only the particles near the obstacle are tested
+    EXPECT_EQ(candidates.size(), evaluations);
+    EXPECT_GT(particleVector.size() / 100u, evaluations);
+}
+
+void CollisionsTestSuite::multipleObstacles()
+{
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 2.0, 2.0, 2.0));
+
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.5), 0.01),
+                                   Particle(SPHAlgorithms::Point3D(1.5, 1.5, 1.5), 0.01),
+                                   Particle(SPHAlgorithms::Point3D(1.0, 1.0, 1.0), 0.01)};
+
+    for (Particle& particle : particleVector)
+    {
+        particle.previous_position = particle.position + SPHAlgorithms::Point3D(0.0, 0.0, 0.3);
+        particle.velocity = SPHAlgorithms::Point3D(0.0, 0.0, -1.0);
+    }
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, 0.1, 0.001);
+    searcher.search(particleVector);
+
+    using namespace SPHAlgorithms::ShapeExpressions;
+    const std::vector<Obstacle> obstacles = {Obstacle(Sphere(SPHAlgorithms::Point3F(0.5f, 0.5f, 0.5f), 0.2f)),
+                                             Obstacle(Sphere(SPHAlgorithms::Point3F(1.5f, 1.5f, 1.5f), 0.2f))};
+
+    std::vector<SPHAlgorithms::Cuboid> obstacleBounds;
+    for (const Obstacle& obstacle : obstacles)
+        obstacleBounds.push_back(obstacle.getBoundingCuboid());
+
+    const ObstacleIndex index(searcher, obstacleBounds, 0.01);
+
+    Collision::detectCollisions(particleVector, volume, obstacles, index.findCandidates(searcher));
+
+    // the particles inside of the obstacles are returned, the one between them is kept
+    EXPECT_DOUBLE_EQ(0.8, particleVector[0].position.z);
+    EXPECT_DOUBLE_EQ(1.8, particleVector[1].position.z);
+    EXPECT_DOUBLE_EQ(1.0, particleVector[2].position.z);
+    EXPECT_DOUBLE_EQ(-1.0, particleVector[2].velocity.z);
+}
+
+void CollisionsTestSuite::movingObstacle()
+{
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 2.0, 2.0, 2.0));
+
+    // the sphere with radius 0.2 around the local origin placed into the center of the volume and moving up
+    using namespace SPHAlgorithms::ShapeExpressions;
+    Obstacle obstacle(Sphere(SPHAlgorithms::Point3F(0.f, 0.f, 0.f), 0.2f),
+                      SPHAlgorithms::RigidTransform(SPHAlgorithms::Point3D(1.0, 1.0, 1.0)));
+    obstacle.setVelocity(SPHAlgorithms::Point3D(0.0, 0.0, 1.0), SPHAlgorithms::Point3D());
+
+    const std::vector<Obstacle> obstacles = {obstacle};
+    const SPHAlgorithms::VectorOfSizetVectors candidates = {{0u}};
+
+    // the falling particle inside of the obstacle is reflected relative to its surface
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(1.0, 1.0, 1.15), 0.01)};
+    particleVector[0].previous_position = SPHAlgorithms::Point3D(1.0, 1.0, 1.3);
+    particleVector[0].velocity = SPHAlgorithms::Point3D(0.0, 0.0, -1.0);
+
+    Collision::detectCollisions(particleVector, volume, obstacles, candidates);
+
+    EXPECT_DOUBLE_EQ(1.3, particleVector[0].position.z);
+    EXPECT_DOUBLE_EQ(1.0 - 2.0 * Config::CollisionVelocityMultiplier, particleVector[0].velocity.z);
+
+    // the field is sampled in the local space, the particle rising slower than the obstacle is hit by it
+    const std::vector<SPHAlgorithms::DistanceField> obstacleFields = {SPHAlgorithms::DistanceField(
+        obstacle.getEquation(), SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(-0.5, -0.5, -0.5), 1.0, 1.0, 1.0),
+        0.02)};
+
+    particleVector[0].position = SPHAlgorithms::Point3D(1.0, 1.0, 1.15);
+    particleVector[0].velocity = SPHAlgorithms::Point3D(0.0, 0.0, 0.5);
+
+    Collision::detectCollisions(particleVector, volume, obstacles, obstacleFields, candidates);
+
+    // the normalized sphere equation overestimates the penetration depth
+    EXPECT_NEAR(1.21, particleVector[0].position.z, 1e-2);
+    EXPECT_NEAR(1.0 - 0.5 * Config::CollisionVelocityMultiplier, particleVector[0].velocity.z, 1e-3);
+
+    // the obstacle moves by its velocities, the rotation is around its local origin
+    obstacle.move(0.1);
+    EXPECT_NEAR(1.1, obstacle.getTransform().getTranslation().z, 1e-12);
+    EXPECT_NEAR(0.2, obstacle(1.0f, 1.0f, 1.29f) + 0.2f, 1e-2f);
+
+    const double pi = 3.14159265358979323846;
+    obstacle.setVelocity(SPHAlgorithms::Point3D(), SPHAlgorithms::Point3D(0.0, 0.0, pi));
+    EXPECT_NEAR(pi, obstacle.getVelocity(SPHAlgorithms::Point3D(2.0, 1.0, 1.1)).y, 1e-12);
+
+    obstacle.move(0.5);
+    EXPECT_NEAR(1.0, obstacle.getTransform().getTranslation().x, 1e-12);
+    EXPECT_NEAR(0.0, obstacle.getTransform().rotate(SPHAlgorithms::Point3D(1.0, 0.0, 0.0)).x, 1e-12);
+    EXPECT_NEAR(1.0, obstacle.getTransform().rotate(SPHAlgorithms::Point3D(1.0, 0.0, 0.0)).y, 1e-12);
+}
+
+void CollisionsTestSuite::shiftedBoundaryCollision()
+{
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(-1.05, 0.0, 0.0), 0.1),
+                                   Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.95), 0.1)};
+    particleVector[0].velocity = SPHAlgorithms::Point3D(-1.0, 0.0, 0.0);
+    particleVector[1].velocity = SPHAlgorithms::Point3D(0.0, 0.0, 1.0);
+
+    // the volume is not started at the origin
+    SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(-1.0, -1.0, -1.0), 2.0, 2.0, 2.0));
+
+    Collision::detectCollisions(particleVector, volume);
+
+    EXPECT_DOUBLE_EQ(-0.9, particleVector[0].position.x);
+    EXPECT_DOUBLE_EQ(Config::CollisionVelocityMultiplier * -1.0, particleVector[0].velocity.x);
+    EXPECT_DOUBLE_EQ(0.9, particleVector[1].position.z);
+    EXPECT_DOUBLE_EQ(Config::CollisionVelocityMultiplier, particleVector[1].velocity.z);
+}
+
+void CollisionsTestSuite::domainBoundaryCollision()
+{
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(1.95, 1.0, 1.0), 0.1),
+                                   Particle(SPHAlgorithms::Point3D(1.0, 1.0, 1.0), 0.1)};
+    particleVector[0].velocity = SPHAlgorithms::Point3D(1.0, 1.0, 0.0);
+    particleVector[1].velocity = SPHAlgorithms::Point3D(1.0, 1.0, 0.0);
+
+    // the cylindrical tank with radius 1 along z axis
+    SPHAlgorithms::Volume volume(
+        SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 2.0, 2.0, 2.0),
+        [](float x, float y, float) { return 1.f - (x - 1.f) * (x - 1.f) - (y - 1.f) * (y - 1.f); }, 0.02);
+
+    Collision::detectCollisions(particleVector, volume);
+
+    // the particle is pushed into the tank and its normal velocity is reflected
+    EXPECT_NEAR(1.9, particleVector[0].position.x, 5e-3);
+    EXPECT_NEAR(Config::CollisionVelocityMultiplier, particleVector[0].velocity.x, 1e-3);
+    EXPECT_NEAR(1.0, particleVector[0].velocity.y, 1e-3);
+
+    EXPECT_DOUBLE_EQ(1.0, particleVector[1].position.x);
+    EXPECT_DOUBLE_EQ(1.0, particleVector[1].velocity.x);
+}
+
+void CollisionsTestSuite::periodicBoundaryCollision()
+{
+    ParticleVect particleVector = {Particle(SPHAlgorithms::Point3D(1.05, 0.5, 1.05), 0.1),
+                                   Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.5), 0.1)};
+    particleVector[0].previous_position = SPHAlgorithms::Point3D(0.95, 0.5, 0.95);
+    particleVector[0].velocity = SPHAlgorithms::Point3D(1.0, 0.0, 1.0);
+
+    const SPHAlgorithms::Cuboid cuboid(SPHAlgorithms::Point3D(0.0, 0.0, 0.0), 1.0, 1.0, 1.0);
+    SPHAlgorithms::Volume volume(cuboid);
+
+    // only the x axis is periodic
+    const SPHAlgorithms::Periodicity periodicity(cuboid, true, false, false);
+
+    Collision::detectCollisions(particleVector, volume, nullptr, periodicity);
+
+    // the particle enters through the opposite face along x and keeps its velocity, the z face reflects it
+    EXPECT_NEAR(0.05, particleVector[0].position.x, 1e-12);
+    EXPECT_NEAR(-0.05, particleVector[0].previous_position.x, 1e-12);
+    EXPECT_DOUBLE_EQ(1.0, particleVector[0].velocity.x);
+    EXPECT_DOUBLE_EQ(0.9, particleVector[0].position.z);
+    EXPECT_DOUBLE_EQ(Config::CollisionVelocityMultiplier, particleVector[0].velocity.z);
+
+    // the particles collide across the periodic face, the first one is pushed away from the nearest image
+    particleVector[1].position = SPHAlgorithms::Point3D(0.995, 0.5, 0.5);
+    particleVector[0].position = SPHAlgorithms::Point3D(0.005, 0.5, 0.5);
+    particleVector[0].velocity = SPHAlgorithms::Point3D(-1.0, 0.0, 0.0);
+    particleVector[0].neighbours = {1};
+
+    Collision::detectCollisions(particleVector, volume, nullptr, periodicity);
+
+    EXPECT_NEAR(0.005 + Config::ParticleRadius, particleVector[0].position.x, 1e-12);
+    EXPECT_DOUBLE_EQ(1.0, particleVector[0].velocity.x);
+}
+
 } // namespace TestEnvironment
 } // namespace SPHSDK
 
@@ -414,3 +684,43 @@ TEST(CollisionsTestSuite, threeOnBoundaryParticleCollision)
 {
     CollisionsTestSuite::threeOnBoundaryParticleCollision();
 }
+
+TEST(CollisionsTestSuite, obstacleFieldCollision)
+{
+    CollisionsTestSuite::obstacleFieldCollision();
+}
+
+TEST(CollisionsTestSuite, obstacleExpressionCollision)
+{
+    CollisionsTestSuite::obstacleExpressionCollision();
+}
+
+TEST(CollisionsTestSuite, obstacleCulling)
+{
+    CollisionsTestSuite::obstacleCulling();
+}
+
+TEST(CollisionsTestSuite, multipleObstacles)
+{
+    CollisionsTestSuite::multipleObstacles();
+}
+
+TEST(CollisionsTestSuite, movingObstacle)
+{
+    CollisionsTestSuite::movingObstacle();
+}
+
+TEST(CollisionsTestSuite, shiftedBoundaryCollision)
+{
+    CollisionsTestSuite::shiftedBoundaryCollision();
+}
+
+TEST(CollisionsTestSuite, domainBoundaryCollision)
+{
+    CollisionsTestSuite::domainBoundaryCollision();
+}
+
+TEST(CollisionsTestSuite, periodicBoundaryCollision)
+{
+    CollisionsTestSuite::periodicBoundaryCollision();
+}
@@ -35,6 +35,15 @@ public:
     static void twoOnBoundaryParticleCollision();
 
     static void threeOnBoundaryParticleCollision();
+
+    static void obstacleFieldCollision();
+    static void obstacleExpressionCollision();
+    static void obstacleCulling();
+    static void multipleObstacles();
+    static void movingObstacle();
+    static void shiftedBoundaryCollision();
+    static void domainBoundaryCollision();
+    static void periodicBoundaryCollision();
 };
 
 } // namespace TestEnvironment
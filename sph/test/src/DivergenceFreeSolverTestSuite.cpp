@@ -0,0 +1,134 @@
+/**
+ * @file DivergenceFreeSolverTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "DivergenceFreeSolverTestSuite.h"
+
+#include "DivergenceFreeSolver.h"
+#include "Kernels.h"
+#include "Scene.h"
+#include "TestScenes.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const SPHAlgorithms::Point3D Center(0.5, 0.5, 0.5);
+
+static const SPHAlgorithms::Volume UnitVolume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+
+void DivergenceFreeSolverTestSuite::factors()
+{
+    ParticleVect particles = TestScenes::createCube(UnitVolume, 9u, Scene::calcRestSpacing());
+    particles.push_back(Particle(SPHAlgorithms::Point3D(0.1, 0.1, 0.1)));
+
+    DivergenceFreeSolver solver;
+    solver.computeDensitiesAndFactors(particles);
+
+    const size_t center = (particles.size() - 1u) / 2u;
+
+    EXPECT_NEAR(Config::WaterDensity, particles[center].density, 0.01 * Config::WaterDensity);
+    EXPECT_LT(0., solver.m_factors[center]);
+
+    // the gradients of the corner particle do not cancel out, it is moved by its own pressure mostly
+    EXPECT_GT(solver.m_factors[center], solver.m_factors.front());
+    EXPECT_LT(0., solver.m_factors.front());
+
+    // the lonely particle
+    EXPECT_DOUBLE_EQ(Config::WaterParticleMass * MullerKernel<double>::value(0., Config::WaterSupportRadius),
+                     particles.back().density);
+    EXPECT_DOUBLE_EQ(0., solver.m_factors.back());
+}
+
+/**
+ * @brief The block contracts to its center, the divergence-free solve stops the compression.
+ */
+void DivergenceFreeSolverTestSuite::divergenceSolveStopsCompression()
+{
+    const double timeStep = 0.005;
+
+    ParticleVect particles = TestScenes::createCube(UnitVolume, 9u, 0.98 * Scene::calcRestSpacing());
+
+    for (auto& particle : particles)
+        particle.velocity = (Center - particle.position) * 2.;
+
+    DivergenceFreeSolver solver;
+    solver.computeDensitiesAndFactors(particles);
+
+    const size_t center = particles.size() / 2u;
+    const double initialDensityRate = solver.calcDensityRate(particles, center);
+
+    solver.correctDivergenceError(particles, timeStep);
+
+    EXPECT_LT(0u, solver.getDivergenceIterationsNumber());
+    EXPECT_GT(Config::DensityErrorTolerance, solver.getDivergenceError());
+    EXPECT_LT(0., initialDensityRate);
+    EXPECT_GT(0.1 * initialDensityRate, solver.calcDensityRate(particles, center));
+}
+
+/**
+ * @brief The density solve of the compressed block takes at least its two iterations, and the corrected
+ * velocities push the particles out of its center.
+ */
+void DivergenceFreeSolverTestSuite::compressedBlockIsCorrected()
+{
+    ParticleVect particles = TestScenes::createCube(UnitVolume, 9u, 0.95 * Scene::calcRestSpacing());
+
+    DivergenceFreeSolver solver;
+    solver.step(particles);
+
+    EXPECT_LE(2u, solver.getDensityIterationsNumber());
+    EXPECT_GT(Config::DensityErrorTolerance, solver.getDensityError());
+
+    TestScenes::expectCornersMoveApart(particles);
+}
+
+/**
+ * @brief The dam break takes the steps of the velocity, and both the density and the divergence solves stay
+ * within their iterations.
+ */
+void DivergenceFreeSolverTestSuite::damBreakKeepsDensity()
+{
+    const auto iterationsNumber = [](const Solver& solver) {
+        const DivergenceFreeSolver& divergenceFreeSolver = static_cast<const DivergenceFreeSolver&>(solver);
+        return divergenceFreeSolver.getDensityIterationsNumber() + divergenceFreeSolver.getDivergenceIterationsNumber();
+    };
+
+    const TestScenes::DamBreakStatistics statistics =
+        TestScenes::runDamBreak(std::unique_ptr<Solver>(new DivergenceFreeSolver()), 0.2, iterationsNumber);
+
+    EXPECT_GT(50u, statistics.stepsNumber);
+    EXPECT_GE(2u * Config::MaxPressureIterations, statistics.maxIterationsNumber);
+    EXPECT_GT(0.01, statistics.maxMeanCompression);
+    EXPECT_LT(0.25, statistics.maxX);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(DivergenceFreeSolverTestSuite, factors)
+{
+    DivergenceFreeSolverTestSuite::factors();
+}
+
+TEST(DivergenceFreeSolverTestSuite, divergenceSolveStopsCompression)
+{
+    DivergenceFreeSolverTestSuite::divergenceSolveStopsCompression();
+}
+
+TEST(DivergenceFreeSolverTestSuite, compressedBlockIsCorrected)
+{
+    DivergenceFreeSolverTestSuite::compressedBlockIsCorrected();
+}
+
+TEST(DivergenceFreeSolverTestSuite, damBreakKeepsDensity)
+{
+    DivergenceFreeSolverTestSuite::damBreakKeepsDensity();
+}
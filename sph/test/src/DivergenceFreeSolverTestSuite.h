@@ -0,0 +1,31 @@
+/**
+ * @file DivergenceFreeSolverTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef DIVERGENCE_FREE_SOLVER_TEST_SUITE_H_62D6688BDB624DADAA6300C5548C26B5
+#define DIVERGENCE_FREE_SOLVER_TEST_SUITE_H_62D6688BDB624DADAA6300C5548C26B5
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class DivergenceFreeSolverTestSuite
+{
+public:
+    static void factors();
+
+    static void divergenceSolveStopsCompression();
+
+    static void compressedBlockIsCorrected();
+
+    static void damBreakKeepsDensity();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // DIVERGENCE_FREE_SOLVER_TEST_SUITE_H_62D6688BDB624DADAA6300C5548C26B5
@@ -9,6 +9,7 @@
 #include "algorithms/src/NeighboursSearch.h"
 
 #include "Forces.h"
+#include "Scene.h"
 
 #include <gtest/gtest.h>
 
@@ -680,6 +681,61 @@ void ForcesTestSuite::allForcesForThreeNeighbours()
     EXPECT_NEAR(-16267.771547133523, particleVect[3].fTotal.z, Precision);
 }
 
+void ForcesTestSuite::densityForDifferentSupportRadii()
+{
+    // the particles are neighbours by the symmetrized support radius 0.15 only
+    Particle fineParticle(SPHAlgorithms::Point3D(1.0, 1.0, 1.0), 0.01);
+    Particle coarseParticle(SPHAlgorithms::Point3D(1.0, 1.12, 1.0), 0.01);
+    Particle farParticle(SPHAlgorithms::Point3D(1.12, 1.0, 1.0), 0.01);
+    fineParticle.supportRadius = 0.1;
+    coarseParticle.supportRadius = 0.2;
+    farParticle.supportRadius = 0.1;
+    fineParticle.neighbours = {1, 2};
+    coarseParticle.neighbours = {0};
+    farParticle.neighbours = {0};
+
+    ParticleVect particleVect = {fineParticle, coarseParticle, farParticle};
+
+    Forces::ComputeDensity(particleVect);
+    Forces::ComputePressure(particleVect);
+    Forces::ComputeInternalForces(particleVect);
+
+    EXPECT_NEAR(1566.6814710608444 + 0.43315609311890235, particleVect[0].density, Precision);
+    EXPECT_NEAR(195.83518388260555 + 0.43315609311890235, particleVect[1].density, Precision);
+    EXPECT_NEAR(1566.6814710608444, particleVect[2].density, Precision);
+
+    // the pressure forces of the pair have the opposite directions
+    EXPECT_GT(0.0, particleVect[0].fPressure.y * particleVect[1].fPressure.y);
+    EXPECT_NEAR(0.0, particleVect[2].fPressure.x, Precision);
+}
+
+void ForcesTestSuite::surfaceTensionIgnoresSkin()
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1.0, 1.0, 1.0));
+
+    ParticleVect particleVect =
+        Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.3, 0.3, 0.3), 0.3, 0.3, 0.3));
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, Config::WaterSupportRadius, 0.001);
+    searcher.search(particleVect);
+    Forces::ComputeDensity(particleVect);
+    Forces::ComputeSurfaceTension(particleVect);
+
+    ParticleVect skinParticleVect = particleVect;
+
+    // the neighbours found within the skin beyond the support radius do not change the surface
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> skinSearcher(volume, 1.5 * Config::WaterSupportRadius, 0.001);
+    skinSearcher.search(skinParticleVect);
+    Forces::ComputeSurfaceTension(skinParticleVect);
+
+    for (size_t i = 0; i < particleVect.size(); i++)
+    {
+        EXPECT_NEAR(particleVect[i].fSurfaceTension.x, skinParticleVect[i].fSurfaceTension.x, Precision);
+        EXPECT_NEAR(particleVect[i].fSurfaceTension.y, skinParticleVect[i].fSurfaceTension.y, Precision);
+        EXPECT_NEAR(particleVect[i].fSurfaceTension.z, skinParticleVect[i].fSurfaceTension.z, Precision);
+    }
+}
+
 } // namespace TestEnvironment
 } // namespace SPHSDK
 
@@ -771,3 +827,13 @@ TEST(ForcesTestSuite, allForcesForThreeNeighbours)
 {
     ForcesTestSuite::allForcesForThreeNeighbours();
 }
+
+TEST(ForcesTestSuite, densityForDifferentSupportRadii)
+{
+    ForcesTestSuite::densityForDifferentSupportRadii();
+}
+
+TEST(ForcesTestSuite, surfaceTensionIgnoresSkin)
+{
+    ForcesTestSuite::surfaceTensionIgnoresSkin();
+}
@@ -55,6 +55,10 @@ public:
     static void allForcesForTwoNeighbours();
 
     static void allForcesForThreeNeighbours();
+
+    static void densityForDifferentSupportRadii();
+
+    static void surfaceTensionIgnoresSkin();
 };
 
 } // namespace TestEnvironment
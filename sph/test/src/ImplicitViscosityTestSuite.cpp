@@ -0,0 +1,143 @@
+/**
+ * @file ImplicitViscosityTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "ImplicitViscosityTestSuite.h"
+
+#include "DivergenceFreeSolver.h"
+#include "ImplicitViscosity.h"
+#include "TestScenes.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const double TimeStep = 0.01;
+
+// The viscosity of the honey-like fluid, the explicit viscosity needs the steps a few hundred times shorter
+static const double HighViscosity = 1000. * Config::WaterViscosity;
+
+/**
+ * @brief Returns the block of 9^3 particles in the middle of the unit volume at the rest density with
+ * the neighbours found.
+ */
+static ParticleVect createBlock()
+{
+    ParticleVect particles = TestScenes::createCube(
+        SPHAlgorithms::Volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.)), 9u);
+
+    for (auto& particle : particles)
+        particle.density = Config::WaterDensity;
+
+    return particles;
+}
+
+void ImplicitViscosityTestSuite::uniformVelocityIsKept()
+{
+    ParticleVect particles = createBlock();
+
+    for (auto& particle : particles)
+        particle.velocity = SPHAlgorithms::Point3D(1., 0., -0.5);
+
+    ImplicitViscosity viscosity(HighViscosity);
+    viscosity.integrate(particles, TimeStep);
+
+    // the velocities before the step are the solution already
+    EXPECT_EQ(0u, viscosity.getIterationsNumber());
+
+    for (const auto& particle : particles)
+    {
+        EXPECT_DOUBLE_EQ(1., particle.velocity.x);
+        EXPECT_DOUBLE_EQ(0., particle.velocity.y);
+        EXPECT_DOUBLE_EQ(-0.5, particle.velocity.z);
+        EXPECT_DOUBLE_EQ(0., particle.fViscosity.calcNormSqr());
+    }
+}
+
+/**
+ * @brief The layers of the block slide along each other, the viscosity slows them down without the overshoot
+ * of the explicit scheme and keeps their momentum.
+ */
+void ImplicitViscosityTestSuite::shearDecaysWithoutOvershoot()
+{
+    ParticleVect particles = createBlock();
+
+    double initialMomentum = 0.;
+    for (auto& particle : particles)
+    {
+        particle.velocity = SPHAlgorithms::Point3D(particle.position.z > 0.5 ? 1. : -1., 0., 0.);
+        initialMomentum += particle.velocity.x;
+    }
+
+    ImplicitViscosity viscosity(HighViscosity);
+    viscosity.integrate(particles, TimeStep);
+
+    EXPECT_LT(0u, viscosity.getIterationsNumber());
+    EXPECT_GT(Config::ViscosityErrorTolerance, viscosity.getResidual());
+
+    double momentum = 0.;
+    double meanSpeed = 0.;
+
+    for (const auto& particle : particles)
+    {
+        EXPECT_GE(1., std::abs(particle.velocity.x));
+        momentum += particle.velocity.x;
+        meanSpeed += std::abs(particle.velocity.x) / particles.size();
+    }
+
+    // the pairwise forces are equal and opposite
+    EXPECT_NEAR(initialMomentum, momentum, 1e-6 * particles.size());
+    EXPECT_GT(0.5, meanSpeed);
+}
+
+/**
+ * @brief The viscous column collapses with the steps of the velocity.
+ */
+void ImplicitViscosityTestSuite::viscousDamBreakKeepsTimeStep()
+{
+    const double simulatedTime = 0.1;
+
+    std::unique_ptr<DivergenceFreeSolver> solver(new DivergenceFreeSolver());
+    solver->setImplicitViscosity(HighViscosity);
+
+    const auto iterationsNumber = [](const Solver& divergenceFreeSolver) {
+        const ImplicitViscosity& viscosity =
+            *static_cast<const DivergenceFreeSolver&>(divergenceFreeSolver).getImplicitViscosity();
+        return viscosity.getIterationsNumber();
+    };
+
+    const TestScenes::DamBreakStatistics statistics =
+        TestScenes::runDamBreak(std::move(solver), simulatedTime, iterationsNumber);
+
+    EXPECT_GE(11u, statistics.stepsNumber);
+    EXPECT_GT(Config::MaxViscosityIterations, statistics.maxIterationsNumber);
+    // not faster than the free fall
+    EXPECT_GT(-Config::GravitationalAcceleration.z * simulatedTime * 1.1, statistics.maxSpeed);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(ImplicitViscosityTestSuite, uniformVelocityIsKept)
+{
+    ImplicitViscosityTestSuite::uniformVelocityIsKept();
+}
+
+TEST(ImplicitViscosityTestSuite, shearDecaysWithoutOvershoot)
+{
+    ImplicitViscosityTestSuite::shearDecaysWithoutOvershoot();
+}
+
+TEST(ImplicitViscosityTestSuite, viscousDamBreakKeepsTimeStep)
+{
+    ImplicitViscosityTestSuite::viscousDamBreakKeepsTimeStep();
+}
@@ -0,0 +1,29 @@
+/**
+ * @file ImplicitViscosityTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef IMPLICIT_VISCOSITY_TEST_SUITE_H_0FF2892CEF864F1EB33C3126F247C1EC
+#define IMPLICIT_VISCOSITY_TEST_SUITE_H_0FF2892CEF864F1EB33C3126F247C1EC
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class ImplicitViscosityTestSuite
+{
+public:
+    static void uniformVelocityIsKept();
+
+    static void shearDecaysWithoutOvershoot();
+
+    static void viscousDamBreakKeepsTimeStep();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // IMPLICIT_VISCOSITY_TEST_SUITE_H_0FF2892CEF864F1EB33C3126F247C1EC
@@ -7,6 +7,11 @@
 #include "IntegratorTestSuite.h"
 
 #include "Integrator.h"
+#include "SPH.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <cmath>
 
 #include <gtest/gtest.h>
 
@@ -51,6 +56,104 @@ void IntegratorTestSuite::oneParticleWithZeroDensity()
     EXPECT_DOUBLE_EQ(1.000005, particles[0].position.z);
 }
 
+/**
+ * @brief Integrates the harmonic oscillator x'' = -(2 pi)^2 x of the unit amplitude and period by the scheme,
+ * returns the largest |x| over the last period.
+ */
+template <class Scheme> static double calcOscillatorAmplitude(size_t periodsNumber, size_t stepsPerPeriod)
+{
+    const double stiffness = 4. * M_PI * M_PI;
+    const double timeStep = 1. / stepsPerPeriod;
+
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(1., 0., 0.))};
+    particles[0].density = 1.;
+
+    double amplitude = 0.;
+
+    for (size_t step = 0; step < periodsNumber * stepsPerPeriod; step++)
+    {
+        for (size_t stage = 0; stage < Scheme::StagesNumber; stage++)
+        {
+            particles[0].fTotal = particles[0].position * -stiffness;
+            Integrator::integrateStage<Scheme>(stage, timeStep, particles, false);
+        }
+
+        if (step >= (periodsNumber - 1u) * stepsPerPeriod)
+            amplitude = std::max(amplitude, std::abs(particles[0].position.x));
+    }
+
+    return amplitude;
+}
+
+/**
+ * @brief The symplectic schemes keep the amplitude of the oscillator with 20 steps per period, the midpoint scheme
+ * gains the energy every period and keeps it with the shorter steps only.
+ */
+void IntegratorTestSuite::oscillatorAmplitude()
+{
+    const size_t periodsNumber = 50u;
+
+    EXPECT_NEAR(1., calcOscillatorAmplitude<LeapfrogScheme>(periodsNumber, 20u), 0.01);
+    EXPECT_NEAR(1., calcOscillatorAmplitude<SymplecticEulerScheme>(periodsNumber, 20u), 0.01);
+
+    EXPECT_LT(2., calcOscillatorAmplitude<MidpointScheme>(periodsNumber, 20u));
+    EXPECT_NEAR(1., calcOscillatorAmplitude<MidpointScheme>(periodsNumber, 100u), 0.01);
+}
+
+/**
+ * @brief The leapfrog is exact for the constant acceleration, the velocity is of the positions the forces were
+ * computed at. The particle gets the velocity and the acceleration of the step before the fall from rest.
+ */
+void IntegratorTestSuite::leapfrogFreeFall()
+{
+    const double timeStep = 0.01;
+    const size_t stepsNumber = 10u;
+
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(0., 0., 1.))};
+    particles[0].density = Config::WaterDensity;
+    particles[0].velocity = Config::GravitationalAcceleration * -timeStep;
+    particles[0].acceleration = Config::GravitationalAcceleration;
+
+    for (size_t step = 0; step < stepsNumber; step++)
+    {
+        particles[0].fTotal = Config::GravitationalAcceleration * particles[0].density;
+        Integrator::integrateStage<LeapfrogScheme>(0u, timeStep, particles);
+    }
+
+    const double time = stepsNumber * timeStep;
+    const double gravity = Config::GravitationalAcceleration.z;
+
+    EXPECT_NEAR(1. + gravity * time * time / 2., particles[0].position.z, 1e-12);
+    EXPECT_NEAR(1. + gravity * (time - timeStep) * (time - timeStep) / 2., particles[0].previous_position.z, 1e-12);
+    EXPECT_NEAR(gravity * (time - timeStep), particles[0].velocity.z, 1e-12);
+}
+
+/**
+ * @brief The block falls and splashes in the tank, the viscosity and the collisions dissipate the energy, so
+ * the mechanical energy does not grow with any scheme.
+ */
+void IntegratorTestSuite::schemesDissipateEnergy()
+{
+    const auto simulate = [](std::unique_ptr<Solver> solver, const char* name) {
+        SPH sph;
+        sph.particles =
+            Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.1, 0.1, 0.2), 0.2, 0.2, 0.2));
+        sph.setSolver(std::move(solver));
+
+        const double initialEnergy = Integrator::calcMechanicalEnergy(sph.particles);
+
+        while (sph.getTime() < 0.3)
+            sph.run();
+
+        EXPECT_GT(initialEnergy, Integrator::calcMechanicalEnergy(sph.particles)) << name;
+    };
+
+    simulate(std::unique_ptr<Solver>(new ExplicitSolverT<VerletScheme>()), "verlet");
+    simulate(std::unique_ptr<Solver>(new ExplicitSolverT<LeapfrogScheme>()), "leapfrog");
+    simulate(std::unique_ptr<Solver>(new ExplicitSolverT<SymplecticEulerScheme>()), "symplectic euler");
+    simulate(std::unique_ptr<Solver>(new ExplicitSolverT<MidpointScheme>()), "midpoint");
+}
+
 } // namespace TestEnvironment
 } // namespace SPHSDK
 
@@ -65,3 +168,18 @@ TEST(IntegratorTestSuite, oneParticleWithZeroDensity)
 {
     IntegratorTestSuite::oneParticleWithZeroDensity();
 }
+
+TEST(IntegratorTestSuite, oscillatorAmplitude)
+{
+    IntegratorTestSuite::oscillatorAmplitude();
+}
+
+TEST(IntegratorTestSuite, leapfrogFreeFall)
+{
+    IntegratorTestSuite::leapfrogFreeFall();
+}
+
+TEST(IntegratorTestSuite, schemesDissipateEnergy)
+{
+    IntegratorTestSuite::schemesDissipateEnergy();
+}
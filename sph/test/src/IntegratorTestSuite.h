@@ -19,6 +19,12 @@ public:
     static void oneParticleWithZeroVelocity();
 
     static void oneParticleWithZeroDensity();
+
+    static void oscillatorAmplitude();
+
+    static void leapfrogFreeFall();
+
+    static void schemesDissipateEnergy();
 };
 
 } // namespace TestEnvironment
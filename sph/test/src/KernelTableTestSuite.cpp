@@ -0,0 +1,141 @@
+/**
+ * @file KernelTableTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "KernelTableTestSuite.h"
+
+#include "Forces.h"
+#include "KernelTable.h"
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+/**
+ * @brief Returns the largest interpolation error of the shape normalized by its largest value.
+ * The shapes are compared over the distances read from the table.
+ */
+template <class Scalar>
+double KernelTableTestSuite::calcShapeError(const KernelTable<Scalar>& table, size_t shape)
+{
+    const size_t samplesNumber = 100000;
+
+    double maxError = 0.;
+    double maxValue = 0.;
+
+    for (size_t i = 0; i <= samplesNumber; i++)
+    {
+        const Scalar distanceSqr = static_cast<Scalar>(i) / static_cast<Scalar>(samplesNumber);
+
+        if (shape >= static_cast<size_t>(KernelTable<Scalar>::spikyGradientShape) &&
+            distanceSqr < KernelTable<Scalar>::MinTabulatedSqrtDistanceSqr)
+            continue;
+
+        const double value = KernelTable<double>::calcShape(static_cast<typename KernelTable<double>::Shape>(shape),
+                                                            static_cast<double>(distanceSqr));
+
+        const Scalar tabulatedValue =
+            table.interpolate(static_cast<typename KernelTable<Scalar>::Shape>(shape), distanceSqr);
+
+        maxError = std::max(maxError, std::abs(value - static_cast<double>(tabulatedValue)));
+        maxValue = std::max(maxValue, std::abs(value));
+    }
+
+    return maxError / maxValue;
+}
+
+template <class Scalar>
+void KernelTableTestSuite::testTableAccuracy(const char* precision, double polyError, double sqrtError)
+{
+    using Table = KernelTable<Scalar>;
+
+    const Table table(Config::KernelTableSamplesNumber);
+    const char* names[] = {"poly6", "poly6 gradient", "poly6 laplacian", "spiky gradient", "viscous laplacian"};
+
+    for (size_t shape = 0; shape < Table::shapesNumber; shape++)
+    {
+        const double error = calcShapeError(table, shape);
+
+        // the errors go to the properties of the test in the XML report
+        std::ostringstream errorStream;
+        errorStream << error;
+        ::testing::Test::RecordProperty(std::string(precision) + " " + names[shape], errorStream.str());
+
+        EXPECT_GT(shape < static_cast<size_t>(Table::spikyGradientShape) ? polyError : sqrtError, error)
+            << precision << " " << names[shape];
+    }
+
+    // the steep shapes are computed directly near zero
+    const Scalar distanceSqr = Table::MinTabulatedSqrtDistanceSqr / Scalar(4);
+    EXPECT_EQ(Table::calcShape(Table::spikyGradientShape, distanceSqr), table.spikyGradient(distanceSqr));
+    EXPECT_EQ(Table::calcShape(Table::viscosityLaplacianShape, distanceSqr), table.viscosityLaplacian(distanceSqr));
+
+    // all the shapes vanish outside of the support
+    EXPECT_EQ(Scalar(0), table.poly6(Scalar(2)));
+    EXPECT_EQ(Scalar(0), table.spikyGradient(Scalar(2)));
+    EXPECT_EQ(Scalar(0), table.viscosityLaplacian(Scalar(2)));
+}
+
+void KernelTableTestSuite::tableAccuracy()
+{
+    testTableAccuracy<double>("double", 1e-5, 1e-3);
+    testTableAccuracy<float>("float", 1e-5, 1e-3);
+}
+
+void KernelTableTestSuite::forcesWithTables()
+{
+    ParticleVect particles;
+
+    for (size_t iZ = 0; iZ < 5; iZ++)
+        for (size_t iY = 0; iY < 5; iY++)
+            for (size_t iX = 0; iX < 5; iX++)
+            {
+                particles.push_back(Particle(SPHAlgorithms::Point3D(0.44 + 0.03 * iX, 0.44 + 0.03 * iY,
+                                                                    0.44 + 0.03 * iZ)));
+                particles.back().velocity = SPHAlgorithms::Point3D(0.1 * iY, -0.1 * iX, 0.05 * iZ);
+            }
+
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0., 0., 0.), 1., 1., 1.));
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, Config::WaterSupportRadius, 0.001);
+    searcher.search(particles);
+
+    ParticleVect tabulatedParticles = particles;
+
+    Forces::ComputeAllForces(particles);
+    ForcesT<double, TabulatedMullerKernel<double>>::ComputeAllForces(tabulatedParticles);
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        EXPECT_NEAR(particles[i].density, tabulatedParticles[i].density, 1e-5 * particles[i].density);
+
+        const double forceScale = std::max(1.0, particles[i].fTotal.calcNorm());
+        EXPECT_NEAR(particles[i].fTotal.x, tabulatedParticles[i].fTotal.x, 1e-3 * forceScale);
+        EXPECT_NEAR(particles[i].fTotal.y, tabulatedParticles[i].fTotal.y, 1e-3 * forceScale);
+        EXPECT_NEAR(particles[i].fTotal.z, tabulatedParticles[i].fTotal.z, 1e-3 * forceScale);
+    }
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(KernelTableTestSuite, tableAccuracy)
+{
+    KernelTableTestSuite::tableAccuracy();
+}
+
+TEST(KernelTableTestSuite, forcesWithTables)
+{
+    KernelTableTestSuite::forcesWithTables();
+}
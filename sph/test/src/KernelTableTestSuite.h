@@ -0,0 +1,36 @@
+/**
+ * @file KernelTableTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef KERNEL_TABLE_TEST_SUITE_H_2F8D4B6A1E3C4D97A5B0C2E8F7D1A463
+#define KERNEL_TABLE_TEST_SUITE_H_2F8D4B6A1E3C4D97A5B0C2E8F7D1A463
+
+#include "KernelTable.h"
+
+#include <cstddef>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class KernelTableTestSuite
+{
+public:
+    static void tableAccuracy();
+
+    static void forcesWithTables();
+
+private:
+    template <class Scalar> static double calcShapeError(const KernelTable<Scalar>& table, size_t shape);
+
+    template <class Scalar> static void testTableAccuracy(const char* precision, double polyError, double sqrtError);
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // KERNEL_TABLE_TEST_SUITE_H_2F8D4B6A1E3C4D97A5B0C2E8F7D1A463
@@ -0,0 +1,158 @@
+/**
+ * @file KernelsTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "KernelsTestSuite.h"
+
+#include "Forces.h"
+#include "Kernels.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const double SupportRadius = 0.1;
+
+/**
+ * @brief Integrates the kernel over the cube around its support by the midpoint rule.
+ */
+template <class Kernel> static double integrateKernel()
+{
+    const size_t cellsNumber = 80;
+    const double cellSize = 2. * SupportRadius / cellsNumber;
+
+    double integral = 0.;
+
+    for (size_t iZ = 0; iZ < cellsNumber; iZ++)
+        for (size_t iY = 0; iY < cellsNumber; iY++)
+            for (size_t iX = 0; iX < cellsNumber; iX++)
+            {
+                const SPHAlgorithms::Point3D point(-SupportRadius + (iX + 0.5) * cellSize,
+                                                   -SupportRadius + (iY + 0.5) * cellSize,
+                                                   -SupportRadius + (iZ + 0.5) * cellSize);
+
+                if (point.calcNormSqr() < SupportRadius * SupportRadius)
+                    integral += Kernel::value(point.calcNormSqr(), SupportRadius);
+            }
+
+    return integral * cellSize * cellSize * cellSize;
+}
+
+/**
+ * @brief Compares the gradient and the laplacian with the central differences of the kernel.
+ */
+template <class Kernel> static void testDerivatives(const SPHAlgorithms::Point3D& point)
+{
+    const double step = 1e-5;
+    const SPHAlgorithms::Point3D axes[] = {SPHAlgorithms::Point3D(step, 0., 0.), SPHAlgorithms::Point3D(0., step, 0.),
+                                           SPHAlgorithms::Point3D(0., 0., step)};
+
+    const double value = Kernel::value(point.calcNormSqr(), SupportRadius);
+
+    double differences[3];
+    double laplacian = 0.;
+
+    for (size_t axis = 0; axis < 3; axis++)
+    {
+        const double forward = Kernel::value((point + axes[axis]).calcNormSqr(), SupportRadius);
+        const double backward = Kernel::value((point - axes[axis]).calcNormSqr(), SupportRadius);
+
+        differences[axis] = (forward - backward) / (2. * step);
+        laplacian += (forward - 2. * value + backward) / (step * step);
+    }
+
+    const SPHAlgorithms::Point3D gradient = Kernel::gradient(point, SupportRadius);
+    const double gradientScale = gradient.calcNorm();
+
+    EXPECT_NEAR(differences[0], gradient.x, 1e-4 * gradientScale);
+    EXPECT_NEAR(differences[1], gradient.y, 1e-4 * gradientScale);
+    EXPECT_NEAR(differences[2], gradient.z, 1e-4 * gradientScale);
+
+    const double expectedLaplacian = Kernel::laplacian(point.calcNormSqr(), SupportRadius);
+    EXPECT_NEAR(expectedLaplacian, laplacian, 1e-3 * std::abs(expectedLaplacian));
+}
+
+template <class Kernel> static void testGradientsAndLaplacians()
+{
+    testDerivatives<Kernel>(SPHAlgorithms::Point3D(0.01, 0.02, 0.015));
+    testDerivatives<Kernel>(SPHAlgorithms::Point3D(-0.03, 0.04, 0.01));
+    testDerivatives<Kernel>(SPHAlgorithms::Point3D(0.06, -0.05, 0.02));
+}
+
+/**
+ * @brief The pair with the same density pushes both particles apart with the same force and slows them
+ * down with the same viscous force.
+ */
+template <class Kernel> static void testPairForces()
+{
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(1.0, 1.0, 1.0), 0.01),
+                              Particle(SPHAlgorithms::Point3D(1.0, 1.03, 1.0), 0.01)};
+    particles[0].velocity = SPHAlgorithms::Point3D(0.1, 0.2, 0.0);
+    particles[1].velocity = SPHAlgorithms::Point3D(-0.1, -0.2, 0.0);
+    particles[0].neighbours = {1};
+    particles[1].neighbours = {0};
+
+    ForcesT<double, Kernel>::ComputeAllForces(particles);
+
+    EXPECT_GT(particles[0].density, 0.);
+    EXPECT_DOUBLE_EQ(particles[0].density, particles[1].density);
+
+    EXPECT_GT(0., particles[0].fPressure.y);
+    EXPECT_NEAR(-particles[0].fPressure.y, particles[1].fPressure.y, 1e-9 * std::abs(particles[0].fPressure.y));
+
+    // the viscosity opposes the relative velocity
+    EXPECT_GT(0., particles[0].fViscosity.x);
+    EXPECT_GT(0., particles[0].fViscosity.y);
+    EXPECT_NEAR(-particles[0].fViscosity.x, particles[1].fViscosity.x, 1e-9 * std::abs(particles[0].fViscosity.x));
+}
+
+void KernelsTestSuite::kernelsAreNormalized()
+{
+    EXPECT_NEAR(1., integrateKernel<MullerKernel<double>>(), 1e-3);
+    EXPECT_NEAR(1., integrateKernel<TabulatedMullerKernel<double>>(), 1e-3);
+    EXPECT_NEAR(1., integrateKernel<CubicSplineKernel<double>>(), 1e-3);
+    EXPECT_NEAR(1., integrateKernel<WendlandC2Kernel<double>>(), 1e-3);
+    EXPECT_NEAR(1., integrateKernel<WendlandC4Kernel<double>>(), 1e-3);
+}
+
+void KernelsTestSuite::gradientsAndLaplacians()
+{
+    testGradientsAndLaplacians<MullerKernel<double>>();
+    testGradientsAndLaplacians<CubicSplineKernel<double>>();
+    testGradientsAndLaplacians<WendlandC2Kernel<double>>();
+    testGradientsAndLaplacians<WendlandC4Kernel<double>>();
+}
+
+void KernelsTestSuite::pairForcesAreSymmetric()
+{
+    testPairForces<MullerKernel<double>>();
+    testPairForces<TabulatedMullerKernel<double>>();
+    testPairForces<CubicSplineKernel<double>>();
+    testPairForces<WendlandC2Kernel<double>>();
+    testPairForces<WendlandC4Kernel<double>>();
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(KernelsTestSuite, kernelsAreNormalized)
+{
+    KernelsTestSuite::kernelsAreNormalized();
+}
+
+TEST(KernelsTestSuite, gradientsAndLaplacians)
+{
+    KernelsTestSuite::gradientsAndLaplacians();
+}
+
+TEST(KernelsTestSuite, pairForcesAreSymmetric)
+{
+    KernelsTestSuite::pairForcesAreSymmetric();
+}
@@ -0,0 +1,29 @@
+/**
+ * @file KernelsTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef KERNELS_TEST_SUITE_H_5E1C7A3B9D2F4E86B4A0C6D8E2F1A753
+#define KERNELS_TEST_SUITE_H_5E1C7A3B9D2F4E86B4A0C6D8E2F1A753
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class KernelsTestSuite
+{
+public:
+    static void kernelsAreNormalized();
+
+    static void gradientsAndLaplacians();
+
+    static void pairForcesAreSymmetric();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // KERNELS_TEST_SUITE_H_5E1C7A3B9D2F4E86B4A0C6D8E2F1A753
@@ -0,0 +1,190 @@
+/**
+ * @file MultipleTimeStepSolverTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "MultipleTimeStepSolverTestSuite.h"
+
+#include "MultipleTimeStepSolver.h"
+#include "SPH.h"
+#include "Scene.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+/**
+ * @brief Returns the pair of the neighbours at rest and the lone particle far from them moving with the speed,
+ * all at the rest density.
+ */
+static ParticleVect createPairAndLoneParticle(double speed)
+{
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(1., 1., 1.)),
+                              Particle(SPHAlgorithms::Point3D(1.05, 1., 1.)),
+                              Particle(SPHAlgorithms::Point3D(2., 2., 2.))};
+
+    particles[0].neighbours = {1};
+    particles[1].neighbours = {0};
+    particles[2].velocity = SPHAlgorithms::Point3D(speed, 0., 0.);
+
+    WeaklyCompressibleSolver().initialize(particles);
+
+    return particles;
+}
+
+/**
+ * @brief The lone particle is six times faster than the speed of sound, so the pair takes the steps of 4 ticks.
+ */
+void MultipleTimeStepSolverTestSuite::levelsFollowStableSteps()
+{
+    ParticleVect particles = createPairAndLoneParticle(100.);
+    const SPHAlgorithms::Point3D startPosition = particles[2].position;
+
+    MultipleTimeStepSolver solver(4u, true, 20.);
+
+    const double tickTime = Config::CourantNumber * Config::WaterSupportRadius / 120.;
+
+    const size_t activeParticlesNumbers[] = {3u, 1u, 1u, 1u, 3u};
+
+    double time = 0.;
+
+    for (const size_t activeParticlesNumber : activeParticlesNumbers)
+    {
+        time += solver.step(particles);
+
+        EXPECT_EQ(activeParticlesNumber, solver.getActiveParticlesNumber());
+        EXPECT_EQ(2u, solver.getLevel(0));
+        EXPECT_EQ(2u, solver.getLevel(1));
+        EXPECT_EQ(4u, solver.getLevel(2));
+    }
+
+    // the gravity speeds up the lone particle, so the tick after the first 4 is a bit shorter
+    EXPECT_NEAR(5. * tickTime, time, 1e-6 * tickTime);
+
+    // the leapfrog is exact for the constant acceleration
+    const SPHAlgorithms::Point3D expectedPosition = startPosition + SPHAlgorithms::Point3D(100., 0., 0.) * time +
+                                                    Config::GravitationalAcceleration * (time * time / 2.);
+
+    EXPECT_NEAR(expectedPosition.x, particles[2].position.x, 1e-12);
+    EXPECT_NEAR(expectedPosition.z, particles[2].position.z, 1e-12);
+}
+
+/**
+ * @brief The second particle of the pair jumps two levels finer in the middle of the step of the first one,
+ * the first one ends its step earlier then.
+ */
+void MultipleTimeStepSolverTestSuite::coarserNeighboursAreShortened()
+{
+    ParticleVect particles = createPairAndLoneParticle(200.);
+    particles[1].velocity = SPHAlgorithms::Point3D(20., 0., 0.);
+
+    MultipleTimeStepSolver solver(4u, true, 20.);
+
+    for (size_t i = 0; i < 4u; i++)
+        solver.step(particles);
+
+    ASSERT_EQ(1u, solver.getLevel(0));
+    ASSERT_EQ(2u, solver.getLevel(1));
+    ASSERT_EQ(8u, solver.m_endTicks[0]);
+
+    particles[1].velocity = SPHAlgorithms::Point3D(200., 0., 0.);
+
+    const SPHAlgorithms::Point3D velocity = particles[0].velocity;
+
+    solver.step(particles);
+
+    EXPECT_EQ(2u, solver.getActiveParticlesNumber());
+    EXPECT_EQ(4u, solver.getLevel(1));
+    EXPECT_EQ(3u, solver.getLevel(0));
+    EXPECT_EQ(6u, solver.m_endTicks[0]);
+
+    // the opening half kick of 4 ticks is cut to 3 ticks
+    const SPHAlgorithms::Point3D expectedVelocity = velocity + particles[0].acceleration * -solver.m_tickTime;
+
+    EXPECT_NEAR(expectedVelocity.x, particles[0].velocity.x, 1e-12);
+    EXPECT_NEAR(expectedVelocity.z, particles[0].velocity.z, 1e-12);
+}
+
+/**
+ * @brief The drops fly fast above the tank at rest, only they take the short steps: the forces of the tank
+ * are computed a few times less often than by WCSPH for the same time, and its density stays bounded.
+ */
+void MultipleTimeStepSolverTestSuite::calmTankSavesForces()
+{
+    // the drops do not reach the wall
+    const double simulatedTime = 0.025;
+
+    const auto createScene = []() {
+        ParticleVect particles =
+            Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 0.3, 0.3, 0.15));
+        ParticleVect drops =
+            Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.5, 0.1, 0.8), 0.1, 0.1, 0.1));
+
+        for (auto& drop : drops)
+            drop.velocity = SPHAlgorithms::Point3D(0., 100., 0.);
+
+        particles.insert(particles.end(), drops.begin(), drops.end());
+
+        return particles;
+    };
+
+    SPH uniformSPH;
+    uniformSPH.particles = createScene();
+    uniformSPH.setSolver(std::unique_ptr<Solver>(new WeaklyCompressibleSolver()));
+
+    size_t uniformForcesNumber = 0u;
+
+    while (uniformSPH.getTime() < simulatedTime)
+    {
+        uniformSPH.run();
+        uniformForcesNumber += uniformSPH.particles.size();
+    }
+
+    SPH sph;
+    sph.particles = createScene();
+
+    MultipleTimeStepSolver* solver = new MultipleTimeStepSolver();
+    sph.setSolver(std::unique_ptr<Solver>(solver));
+
+    size_t forcesNumber = 0u;
+    double maxCompression = 0.;
+
+    while (sph.getTime() < simulatedTime)
+    {
+        sph.run();
+        forcesNumber += solver->getActiveParticlesNumber();
+
+        for (const auto& particle : sph.particles)
+            maxCompression = std::max(maxCompression, particle.density / Config::WaterDensity - 1.);
+    }
+
+    EXPECT_GT(0.35 * uniformForcesNumber, forcesNumber);
+    EXPECT_GT(0.05, maxCompression);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(MultipleTimeStepSolverTestSuite, levelsFollowStableSteps)
+{
+    MultipleTimeStepSolverTestSuite::levelsFollowStableSteps();
+}
+
+TEST(MultipleTimeStepSolverTestSuite, coarserNeighboursAreShortened)
+{
+    MultipleTimeStepSolverTestSuite::coarserNeighboursAreShortened();
+}
+
+TEST(MultipleTimeStepSolverTestSuite, calmTankSavesForces)
+{
+    MultipleTimeStepSolverTestSuite::calmTankSavesForces();
+}
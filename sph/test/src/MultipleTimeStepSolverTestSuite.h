@@ -0,0 +1,29 @@
+/**
+ * @file MultipleTimeStepSolverTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef MULTIPLE_TIME_STEP_SOLVER_TEST_SUITE_H_3B2EF426FD4F43CCA4C3570531AF0CA6
+#define MULTIPLE_TIME_STEP_SOLVER_TEST_SUITE_H_3B2EF426FD4F43CCA4C3570531AF0CA6
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class MultipleTimeStepSolverTestSuite
+{
+public:
+    static void levelsFollowStableSteps();
+
+    static void coarserNeighboursAreShortened();
+
+    static void calmTankSavesForces();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // MULTIPLE_TIME_STEP_SOLVER_TEST_SUITE_H_3B2EF426FD4F43CCA4C3570531AF0CA6
@@ -0,0 +1,101 @@
+/**
+ * @file ObstacleIndexTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "ObstacleIndexTestSuite.h"
+
+#include "ObstacleIndex.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static ParticleVect createParticles()
+{
+    return {Particle(SPHAlgorithms::Point3D(0.15, 0.15, 0.15), 0.01),
+            Particle(SPHAlgorithms::Point3D(0.85, 0.85, 0.85), 0.01),
+            Particle(SPHAlgorithms::Point3D(0.5, 0.5, 0.5), 0.01)};
+}
+
+void ObstacleIndexTestSuite::emptyIndex()
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, 0.1, 0.001);
+
+    ParticleVect particles = createParticles();
+    searcher.search(particles);
+
+    const ObstacleIndex index(searcher, {}, 0.);
+
+    EXPECT_TRUE(index.m_boxes.empty());
+    EXPECT_TRUE(index.findCandidates(searcher).empty());
+}
+
+void ObstacleIndexTestSuite::candidatesNearObstacles()
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, 0.1, 0.001);
+
+    ParticleVect particles = createParticles();
+    searcher.search(particles);
+
+    const ObstacleIndex index(searcher,
+                              {SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.11, 0.11, 0.11), 0.08, 0.08, 0.08),
+                               SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.81, 0.81, 0.81), 0.08, 0.08, 0.08)},
+                              0.);
+
+    // only the boxes around the obstacles are indexed
+    EXPECT_EQ(2u * 27u, index.m_boxes.size());
+
+    const SPHAlgorithms::VectorOfSizetVectors candidates = index.findCandidates(searcher);
+
+    ASSERT_EQ(2u, candidates.size());
+    EXPECT_EQ(SPHAlgorithms::SizetVector({0}), candidates[0]);
+    EXPECT_EQ(SPHAlgorithms::SizetVector({1}), candidates[1]);
+}
+
+void ObstacleIndexTestSuite::overlappingObstacles()
+{
+    const SPHAlgorithms::Volume volume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(volume, 0.1, 0.001);
+
+    ParticleVect particles = createParticles();
+    searcher.search(particles);
+
+    // the large obstacle contains the small one and the margin reaches the particle in the center
+    const ObstacleIndex index(searcher,
+                              {SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.11, 0.11, 0.11), 0.08, 0.08, 0.08),
+                               SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(0.11, 0.11, 0.11), 0.2, 0.2, 0.2)},
+                              0.1);
+
+    const SPHAlgorithms::VectorOfSizetVectors candidates = index.findCandidates(searcher);
+
+    ASSERT_EQ(2u, candidates.size());
+    EXPECT_EQ(SPHAlgorithms::SizetVector({0}), candidates[0]);
+    EXPECT_EQ(SPHAlgorithms::SizetVector({0, 2}), candidates[1]);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(ObstacleIndexTestSuite, emptyIndex)
+{
+    ObstacleIndexTestSuite::emptyIndex();
+}
+
+TEST(ObstacleIndexTestSuite, candidatesNearObstacles)
+{
+    ObstacleIndexTestSuite::candidatesNearObstacles();
+}
+
+TEST(ObstacleIndexTestSuite, overlappingObstacles)
+{
+    ObstacleIndexTestSuite::overlappingObstacles();
+}
@@ -0,0 +1,29 @@
+/**
+ * @file ObstacleIndexTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef OBSTACLE_INDEX_TEST_SUITE_H_3F9A1D6C8E2B4A7D9C0E5F1B3A8D6C24
+#define OBSTACLE_INDEX_TEST_SUITE_H_3F9A1D6C8E2B4A7D9C0E5F1B3A8D6C24
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class ObstacleIndexTestSuite
+{
+public:
+    static void emptyIndex();
+
+    static void candidatesNearObstacles();
+
+    static void overlappingObstacles();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // OBSTACLE_INDEX_TEST_SUITE_H_3F9A1D6C8E2B4A7D9C0E5F1B3A8D6C24
@@ -0,0 +1,121 @@
+/**
+ * @file PrecisionTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "PrecisionTestSuite.h"
+
+#include "Forces.h"
+#include "Integrator.h"
+#include "TestScenes.h"
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const double TimeStep = 0.01;
+
+static const SPHAlgorithms::Volume UnitVolume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+
+template <class Scalar> static void simulate(ParticleVectT<Scalar>& particles, size_t stepsNumber)
+{
+    SPHAlgorithms::NeighboursSearch3D<ParticleVectT<Scalar>> searcher(UnitVolume, Config::WaterSupportRadius, 0.001);
+
+    for (size_t step = 0; step < stepsNumber; step++)
+    {
+        searcher.search(particles);
+        ForcesT<Scalar>::ComputeAllForces(particles);
+        Integrator::integrate(TimeStep, particles);
+    }
+}
+
+void PrecisionTestSuite::forcesInFloat()
+{
+    ParticleVect particles = TestScenes::createCube<double>(UnitVolume, 5u, 0.03);
+    ParticleFVect particlesF = TestScenes::createCube<float>(UnitVolume, 5u, 0.03);
+
+    // the same neighbours are used by both precisions
+    for (size_t i = 0; i < particles.size(); i++)
+        particlesF[i].neighbours = particles[i].neighbours;
+
+    Forces::ComputeAllForces(particles);
+    ForcesF::ComputeAllForces(particlesF);
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        EXPECT_NEAR(particles[i].density, particlesF[i].density, 1e-5 * particles[i].density);
+
+        const double forceScale = std::max(1.0, particles[i].fTotal.calcNorm());
+        EXPECT_NEAR(particles[i].fTotal.x, particlesF[i].fTotal.x, 1e-4 * forceScale);
+        EXPECT_NEAR(particles[i].fTotal.y, particlesF[i].fTotal.y, 1e-4 * forceScale);
+        EXPECT_NEAR(particles[i].fTotal.z, particlesF[i].fTotal.z, 1e-4 * forceScale);
+    }
+}
+
+/**
+ * @brief Runs the same block in double and float and reports the drift between them by the properties of
+ * the test in the XML report.
+ */
+void PrecisionTestSuite::densityAndEnergyDrift()
+{
+    const size_t stepsNumber = 50;
+
+    ParticleVect particles = TestScenes::createCube<double>(UnitVolume, 8u, 0.04);
+    ParticleFVect particlesF = TestScenes::createCube<float>(UnitVolume, 8u, 0.04);
+
+    simulate(particles, stepsNumber);
+    simulate(particlesF, stepsNumber);
+
+    double maxDensityDrift = 0.;
+    double meanDensityDrift = 0.;
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        const double densityDrift =
+            std::abs(particles[i].density - static_cast<double>(particlesF[i].density)) / particles[i].density;
+
+        maxDensityDrift = std::max(maxDensityDrift, densityDrift);
+        meanDensityDrift += densityDrift / particles.size();
+    }
+
+    const double energy = Integrator::calcMechanicalEnergy(particles);
+    const double energyDrift = std::abs(energy - Integrator::calcMechanicalEnergy(particlesF)) / std::abs(energy);
+
+    const auto recordDrift = [](const char* name, double drift) {
+        std::ostringstream driftStream;
+        driftStream << drift;
+        ::testing::Test::RecordProperty(name, driftStream.str());
+    };
+
+    recordDrift("meanDensityDrift", meanDensityDrift);
+    recordDrift("maxDensityDrift", maxDensityDrift);
+    recordDrift("energyDrift", energyDrift);
+
+    EXPECT_GT(1e-5, meanDensityDrift);
+    EXPECT_GT(1e-4, maxDensityDrift);
+    EXPECT_GT(1e-5, energyDrift);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(PrecisionTestSuite, forcesInFloat)
+{
+    PrecisionTestSuite::forcesInFloat();
+}
+
+TEST(PrecisionTestSuite, densityAndEnergyDrift)
+{
+    PrecisionTestSuite::densityAndEnergyDrift();
+}
@@ -0,0 +1,30 @@
+/**
+ * @file PrecisionTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef PRECISION_TEST_SUITE_H_4C1E9A7B2D6F4E03A8B5C7D9E1F2A364
+#define PRECISION_TEST_SUITE_H_4C1E9A7B2D6F4E03A8B5C7D9E1F2A364
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+/**
+ * @brief PrecisionTestSuite class compares the float solver with the double one.
+ */
+class PrecisionTestSuite
+{
+public:
+    static void forcesInFloat();
+
+    static void densityAndEnergyDrift();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // PRECISION_TEST_SUITE_H_4C1E9A7B2D6F4E03A8B5C7D9E1F2A364
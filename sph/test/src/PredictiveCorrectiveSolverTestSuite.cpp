@@ -0,0 +1,147 @@
+/**
+ * @file PredictiveCorrectiveSolverTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "PredictiveCorrectiveSolverTestSuite.h"
+
+#include "PredictiveCorrectiveSolver.h"
+#include "Scene.h"
+#include "TestScenes.h"
+
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+static const SPHAlgorithms::Volume UnitVolume(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 1., 1., 1.));
+
+/**
+ * @brief The lattice at the rest spacing is not compressed, only the gravity moves it.
+ */
+void PredictiveCorrectiveSolverTestSuite::restBlockHasNoPressure()
+{
+    ParticleVect particles = TestScenes::createCube(UnitVolume, 9u, Scene::calcRestSpacing());
+
+    PredictiveCorrectiveSolver solver;
+    const double timeStep = solver.step(particles);
+
+    EXPECT_DOUBLE_EQ(Config::MaxTimeStep, timeStep);
+    EXPECT_EQ(3u, solver.getIterationsNumber());
+    EXPECT_DOUBLE_EQ(0., solver.getDensityError());
+
+    const Particle& center = particles[particles.size() / 2];
+    EXPECT_DOUBLE_EQ(0., center.pressure);
+    EXPECT_NEAR(Config::GravitationalAcceleration.z * timeStep, center.velocity.z, 1e-9);
+}
+
+/**
+ * @brief The pressure of the compressed block is built up over the iterations until the predicted density error
+ * is within the tolerance, then it pushes the particles out of the center.
+ */
+void PredictiveCorrectiveSolverTestSuite::compressedBlockIsCorrected()
+{
+    ParticleVect particles = TestScenes::createCube(UnitVolume, 9u, 0.9 * Scene::calcRestSpacing());
+
+    PredictiveCorrectiveSolver solver;
+    solver.step(particles);
+
+    EXPECT_LE(3u, solver.getIterationsNumber());
+    EXPECT_GE(Config::MaxPressureIterations, solver.getIterationsNumber());
+    EXPECT_GT(Config::DensityErrorTolerance, solver.getDensityError());
+
+    const Particle& center = particles[particles.size() / 2];
+    EXPECT_LT(0., center.pressure);
+
+    TestScenes::expectCornersMoveApart(particles);
+}
+
+/**
+ * @brief The compressed block moved across the periodic face is corrected as the one in the middle of the volume,
+ * the particles near the face see their neighbours on the opposite side at the nearest images.
+ */
+void PredictiveCorrectiveSolverTestSuite::blockAcrossPeriodicFaceIsCorrected()
+{
+    const SPHAlgorithms::Periodicity periodicity(UnitVolume.getBoundingCuboid(), true, false, false);
+
+    ParticleVect reference = TestScenes::createCube(UnitVolume, 9u, 0.9 * Scene::calcRestSpacing());
+    ParticleVect particles = reference;
+
+    // the center of the block is moved onto the face
+    for (auto& particle : particles)
+    {
+        particle.position = periodicity.wrap(particle.position + SPHAlgorithms::Point3D(0.5, 0., 0.));
+        particle.previous_position = particle.position;
+    }
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVect> searcher(UnitVolume, Config::WaterSupportRadius, 0.001);
+    searcher.setPeriodicity(periodicity);
+    searcher.search(particles);
+
+    PredictiveCorrectiveSolver referenceSolver;
+    referenceSolver.step(reference);
+
+    PredictiveCorrectiveSolver solver;
+    solver.setPeriodicity(periodicity);
+    solver.step(particles);
+
+    EXPECT_EQ(referenceSolver.getIterationsNumber(), solver.getIterationsNumber());
+    EXPECT_NEAR(referenceSolver.getDensityError(), solver.getDensityError(), 1e-12);
+
+    for (size_t i = 0; i < particles.size(); i++)
+    {
+        EXPECT_NEAR(reference[i].density, particles[i].density, 1e-9);
+        EXPECT_NEAR(reference[i].pressure, particles[i].pressure, 1e-6);
+        EXPECT_NEAR(reference[i].velocity.x, particles[i].velocity.x, 1e-9);
+    }
+}
+
+/**
+ * @brief The dam break takes the steps of the velocity, the predicted density keeps the compression below half
+ * a percent on average.
+ */
+void PredictiveCorrectiveSolverTestSuite::damBreakKeepsDensity()
+{
+    const auto iterationsNumber = [](const Solver& solver) {
+        return static_cast<const PredictiveCorrectiveSolver&>(solver).getIterationsNumber();
+    };
+
+    const TestScenes::DamBreakStatistics statistics =
+        TestScenes::runDamBreak(std::unique_ptr<Solver>(new PredictiveCorrectiveSolver()), 0.2, iterationsNumber);
+
+    // the explicit solvers need a few hundreds steps
+    EXPECT_GT(50u, statistics.stepsNumber);
+    EXPECT_GE(Config::MaxPressureIterations, statistics.maxIterationsNumber);
+    EXPECT_GT(0.005, statistics.maxMeanCompression);
+    EXPECT_LT(0.25, statistics.maxX);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(PredictiveCorrectiveSolverTestSuite, restBlockHasNoPressure)
+{
+    PredictiveCorrectiveSolverTestSuite::restBlockHasNoPressure();
+}
+
+TEST(PredictiveCorrectiveSolverTestSuite, compressedBlockIsCorrected)
+{
+    PredictiveCorrectiveSolverTestSuite::compressedBlockIsCorrected();
+}
+
+TEST(PredictiveCorrectiveSolverTestSuite, blockAcrossPeriodicFaceIsCorrected)
+{
+    PredictiveCorrectiveSolverTestSuite::blockAcrossPeriodicFaceIsCorrected();
+}
+
+TEST(PredictiveCorrectiveSolverTestSuite, damBreakKeepsDensity)
+{
+    PredictiveCorrectiveSolverTestSuite::damBreakKeepsDensity();
+}
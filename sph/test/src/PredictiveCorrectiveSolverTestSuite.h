@@ -0,0 +1,31 @@
+/**
+ * @file PredictiveCorrectiveSolverTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef PREDICTIVE_CORRECTIVE_SOLVER_TEST_SUITE_H_ADEE9A3D8019414CB2EB4D62F71D28C5
+#define PREDICTIVE_CORRECTIVE_SOLVER_TEST_SUITE_H_ADEE9A3D8019414CB2EB4D62F71D28C5
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class PredictiveCorrectiveSolverTestSuite
+{
+public:
+    static void restBlockHasNoPressure();
+
+    static void compressedBlockIsCorrected();
+
+    static void blockAcrossPeriodicFaceIsCorrected();
+
+    static void damBreakKeepsDensity();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // PREDICTIVE_CORRECTIVE_SOLVER_TEST_SUITE_H_ADEE9A3D8019414CB2EB4D62F71D28C5
@@ -0,0 +1,274 @@
+/**
+ * @file SPHTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "SPHTestSuite.h"
+
+#include "SPH.h"
+#include "Scene.h"
+#include "WeaklyCompressibleSolver.h"
+
+#include "algorithms/src/ShapeExpressions.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+// The time step is the power of two, so the sums of the steps are exact
+static const double TimeStep = 1. / 128.;
+
+void SPHTestSuite::advanceFollowsFrames()
+{
+    SPH sph;
+    sph.particles = Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 0.1, 0.1, 0.1));
+    sph.setSolver(std::unique_ptr<Solver>(new ExplicitSolver(TimeStep)));
+
+    FrameStatistics statistics = sph.advance(3. * TimeStep);
+
+    EXPECT_EQ(3u, statistics.stepsNumber);
+    EXPECT_EQ(3u, statistics.searchesNumber);
+    EXPECT_EQ(3. * TimeStep, sph.getTime());
+
+    // the last step overruns the frame
+    statistics = sph.advance(2.5 * TimeStep);
+
+    EXPECT_EQ(3u, statistics.stepsNumber);
+    EXPECT_EQ(6. * TimeStep, sph.getTime());
+
+    // the next frame ends at its own time, not at the time of the last step
+    statistics = sph.advance(2.5 * TimeStep);
+
+    EXPECT_EQ(2u, statistics.stepsNumber);
+    EXPECT_EQ(8. * TimeStep, sph.getTime());
+}
+
+namespace
+{
+/**
+ * @brief ShearSolver moves the layers of the particles along each other with their velocities, so the pairs of
+ * the neighbours change, and counts the pairs within the support radius missing in the neighbour lists. The pairs
+ * are the nearest images across the periodic faces.
+ */
+class ShearSolver : public Solver
+{
+public:
+    double step(ParticleVect& particles) override
+    {
+        for (size_t i = 0; i < particles.size(); i++)
+        {
+            for (size_t j = 0; j < particles.size(); j++)
+            {
+                const double distanceSqr = calcDifference(particles[i], particles[j], m_periodicity).calcNormSqr();
+
+                if (i != j && distanceSqr < particles[i].supportRadius * particles[i].supportRadius &&
+                    std::find(particles[i].neighbours.begin(), particles[i].neighbours.end(), j) ==
+                        particles[i].neighbours.end())
+                    missingNeighboursNumber++;
+            }
+        }
+
+        for (auto& particle : particles)
+            particle.position += particle.velocity * TimeStep;
+
+        return TimeStep;
+    }
+
+    size_t missingNeighboursNumber = 0u;
+};
+} // namespace
+
+/**
+ * @brief The neighbours found with the skin are reused while the particles move by less than half the skin,
+ * the lists still have every pair within the support radius.
+ */
+void SPHTestSuite::neighboursAreReusedWithinSkin()
+{
+    const size_t framesNumber = 4u;
+    const size_t frameStepsNumber = 8u;
+
+    SPH sph;
+    // ShearSolver checks all the pairs in every step, so the block is kept small
+    sph.particles = Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(1., 1., 1.), 0.15, 0.15, 0.15));
+
+    for (auto& particle : sph.particles)
+        particle.velocity = SPHAlgorithms::Point3D(0.5 * std::sin(20. * particle.position.z), 0., 0.);
+
+    ShearSolver* solver = new ShearSolver();
+    sph.setSolver(std::unique_ptr<Solver>(solver));
+    sph.setNeighboursSkin(0.5 * Config::WaterSupportRadius);
+
+    size_t searchesNumber = 0u;
+
+    for (size_t i = 0; i < framesNumber; i++)
+    {
+        const FrameStatistics statistics = sph.advance(frameStepsNumber * TimeStep);
+
+        EXPECT_EQ(frameStepsNumber, statistics.stepsNumber);
+        searchesNumber += statistics.searchesNumber;
+    }
+
+    // the fastest particles move by the half of the skin in ~6 steps
+    EXPECT_LT(framesNumber, searchesNumber);
+    EXPECT_GT(framesNumber * frameStepsNumber / 4u, searchesNumber);
+
+    EXPECT_EQ(0u, solver->missingNeighboursNumber);
+}
+
+/**
+ * @brief The obstacle placed by its transform without the velocities is indexed in its new boxes, so it pushes
+ * the particles out.
+ */
+void SPHTestSuite::placedObstacleIsIndexed()
+{
+    using namespace SPHAlgorithms::ShapeExpressions;
+    SPH sph(Obstacle(Sphere(SPHAlgorithms::Point3F(0.f, 0.f, 0.f), 0.3f),
+                     SPHAlgorithms::RigidTransform(SPHAlgorithms::Point3D(1., 1., 1.))),
+            true);
+
+    sph.particles = {Particle(SPHAlgorithms::Point3D(2.5, 2.5, 2.45))};
+    sph.setSolver(std::unique_ptr<Solver>(new ShearSolver()));
+    sph.run();
+
+    sph.getObstacle(0).setTransform(SPHAlgorithms::RigidTransform(SPHAlgorithms::Point3D(2.5, 2.5, 2.5)));
+    sph.run();
+
+    const SPHAlgorithms::Point3D& position = sph.particles[0].position;
+    const SPH& constSph = sph;
+
+    EXPECT_GE(0.f,
+              constSph.getObstacle(0)(static_cast<float>(position.x),
+                                      static_cast<float>(position.y),
+                                      static_cast<float>(position.z)));
+}
+
+/**
+ * @brief The particles leaving through the face of the periodic axis enter through the opposite one, the pairs
+ * across the faces are found by the reused neighbour lists.
+ */
+void SPHTestSuite::periodicAxesWrapParticles()
+{
+    const size_t framesNumber = 4u;
+    const size_t frameStepsNumber = 8u;
+
+    SPH sph;
+    // the block at the periodic face is as small as the one of neighboursAreReusedWithinSkin
+    sph.particles =
+        Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(2.85, 1., 1.), 0.15, 0.15, 0.15));
+
+    for (auto& particle : sph.particles)
+        particle.velocity = SPHAlgorithms::Point3D(1. + 0.5 * std::sin(20. * particle.position.z), 0., 0.);
+
+    ShearSolver* solver = new ShearSolver();
+    sph.setSolver(std::unique_ptr<Solver>(solver));
+    sph.setNeighboursSkin(0.5 * Config::WaterSupportRadius);
+    sph.setPeriodicAxes(true, false, false);
+
+    for (size_t i = 0; i < framesNumber; i++)
+        sph.advance(frameStepsNumber * TimeStep);
+
+    size_t wrappedParticlesNumber = 0u;
+
+    for (const auto& particle : sph.particles)
+    {
+        EXPECT_LE(0., particle.position.x);
+        EXPECT_GT(Config::CubeSize, particle.position.x);
+
+        if (particle.position.x < 1.)
+            wrappedParticlesNumber++;
+    }
+
+    EXPECT_LT(0u, wrappedParticlesNumber);
+    EXPECT_EQ(0u, solver->missingNeighboursNumber);
+}
+
+/**
+ * @brief The kernel policy of the solver is used by the whole step: the boundary particles get their volumes by
+ * the Wendland kernel, and the water block standing in the corner keeps its density against the walls.
+ */
+void SPHTestSuite::kernelPolicyReachesBoundary()
+{
+    using Kernel = WendlandC2Kernel<double>;
+
+    SPH sph;
+    sph.particles = Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 0.2, 0.2, 0.2));
+    sph.setSolver(std::unique_ptr<Solver>(new WeaklyCompressibleSolverT<Kernel>()));
+    sph.setBoundaryParticles();
+
+    // the boundary particle in the middle of the floor
+    const BoundaryParticleVect& boundaryParticles = sph.getBoundary()->getParticles();
+    const SPHAlgorithms::Point3D floorPoint(0.5 * Config::CubeSize, 0.5 * Config::CubeSize, 0.);
+
+    const BoundaryParticle& floorParticle = *std::min_element(
+        boundaryParticles.begin(), boundaryParticles.end(), [&floorPoint](const auto& a, const auto& b) {
+            return (a.position - floorPoint).calcNormSqr() < (b.position - floorPoint).calcNormSqr();
+        });
+
+    const double supportRadius = Config::WaterSupportRadius;
+
+    double kernelSum = 0.;
+    double mullerKernelSum = 0.;
+
+    for (const BoundaryParticle& particle : boundaryParticles)
+    {
+        const double distanceSqr = (particle.position - floorParticle.position).calcNormSqr();
+
+        if (distanceSqr < supportRadius * supportRadius)
+        {
+            kernelSum += Kernel::value(distanceSqr, supportRadius);
+            mullerKernelSum += MullerKernel<double>::value(distanceSqr, supportRadius);
+        }
+    }
+
+    EXPECT_NEAR(1. / kernelSum, floorParticle.volume, 1e-9 * floorParticle.volume);
+    EXPECT_LT(0.01 * floorParticle.volume, std::abs(1. / mullerKernelSum - floorParticle.volume));
+
+    sph.advance(0.1);
+
+    double meanDensityError = 0.;
+
+    for (const auto& particle : sph.particles)
+    {
+        EXPECT_LE(0., particle.position.z);
+        meanDensityError += std::abs(particle.density / Config::WaterDensity - 1.) / sph.particles.size();
+    }
+
+    EXPECT_GT(0.03, meanDensityError);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(SPHTestSuite, advanceFollowsFrames)
+{
+    SPHTestSuite::advanceFollowsFrames();
+}
+
+TEST(SPHTestSuite, neighboursAreReusedWithinSkin)
+{
+    SPHTestSuite::neighboursAreReusedWithinSkin();
+}
+
+TEST(SPHTestSuite, placedObstacleIsIndexed)
+{
+    SPHTestSuite::placedObstacleIsIndexed();
+}
+
+TEST(SPHTestSuite, periodicAxesWrapParticles)
+{
+    SPHTestSuite::periodicAxesWrapParticles();
+}
+
+TEST(SPHTestSuite, kernelPolicyReachesBoundary)
+{
+    SPHTestSuite::kernelPolicyReachesBoundary();
+}
@@ -0,0 +1,33 @@
+/**
+ * @file SPHTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef SPH_TEST_SUITE_H_B0C5151AFAC24E7BB3945505DDA533C3
+#define SPH_TEST_SUITE_H_B0C5151AFAC24E7BB3945505DDA533C3
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class SPHTestSuite
+{
+public:
+    static void advanceFollowsFrames();
+
+    static void neighboursAreReusedWithinSkin();
+
+    static void placedObstacleIsIndexed();
+
+    static void periodicAxesWrapParticles();
+
+    static void kernelPolicyReachesBoundary();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // SPH_TEST_SUITE_H_B0C5151AFAC24E7BB3945505DDA533C3
@@ -0,0 +1,112 @@
+/**
+ * @file TestScenes.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "TestScenes.h"
+
+#include "SPH.h"
+#include "algorithms/src/NeighboursSearch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+namespace TestScenes
+{
+
+template <class Scalar>
+ParticleVectT<Scalar> createCube(const SPHAlgorithms::Volume& volume, size_t sideNumber, double spacing)
+{
+    const SPHAlgorithms::Cuboid& cuboid = volume.getBoundingCuboid();
+    const SPHAlgorithms::Point3D start =
+        cuboid.startingPoint + SPHAlgorithms::Point3D(0.5 * (cuboid.width - spacing * (sideNumber - 1)),
+                                                      0.5 * (cuboid.length - spacing * (sideNumber - 1)),
+                                                      0.5 * (cuboid.height - spacing * (sideNumber - 1)));
+
+    ParticleVectT<Scalar> particles;
+    particles.reserve(sideNumber * sideNumber * sideNumber);
+
+    for (size_t iZ = 0; iZ < sideNumber; iZ++)
+        for (size_t iY = 0; iY < sideNumber; iY++)
+            for (size_t iX = 0; iX < sideNumber; iX++)
+            {
+                const SPHAlgorithms::Point3D position =
+                    start + SPHAlgorithms::Point3D(spacing * iX, spacing * iY, spacing * iZ);
+
+                particles.push_back(ParticleT<Scalar>(SPHAlgorithms::Point3<Scalar>(static_cast<Scalar>(position.x),
+                                                                                    static_cast<Scalar>(position.y),
+                                                                                    static_cast<Scalar>(position.z))));
+                particles.back().previous_position = particles.back().position;
+                particles.back().mass = static_cast<Scalar>(Config::WaterParticleMass);
+            }
+
+    SPHAlgorithms::NeighboursSearch3D<ParticleVectT<Scalar>> searcher(volume, Config::WaterSupportRadius, 0.001);
+    searcher.search(particles);
+
+    return particles;
+}
+
+template ParticleVectT<double> createCube<double>(const SPHAlgorithms::Volume&, size_t, double);
+template ParticleVectT<float> createCube<float>(const SPHAlgorithms::Volume&, size_t, double);
+
+void expectCornersMoveApart(const ParticleVect& particles)
+{
+    EXPECT_GT(0., particles.front().velocity.x);
+    EXPECT_GT(0., particles.front().velocity.y);
+    EXPECT_LT(0., particles.back().velocity.x);
+    EXPECT_LT(0., particles.back().velocity.y);
+}
+
+DamBreakStatistics runDamBreak(std::unique_ptr<Solver>                     solver,
+                               double                                      simulatedTime,
+                               const std::function<size_t(const Solver&)>& iterationsNumber)
+{
+    SPH sph;
+    sph.particles = Scene::createBlock(SPHAlgorithms::Cuboid(SPHAlgorithms::Point3D(), 0.25, 0.25, 0.25));
+    sph.setSolver(std::move(solver));
+
+    DamBreakStatistics statistics;
+
+    while (sph.getTime() < simulatedTime)
+    {
+        sph.run();
+        statistics.stepsNumber++;
+
+        if (iterationsNumber)
+            statistics.maxIterationsNumber =
+                std::max(statistics.maxIterationsNumber, iterationsNumber(sph.getSolver()));
+
+        double meanCompression = 0.;
+        statistics.meanDensityError = 0.;
+
+        for (const auto& particle : sph.particles)
+        {
+            const double compression = particle.density / Config::WaterDensity - 1.;
+
+            statistics.maxCompression = std::max(statistics.maxCompression, compression);
+            meanCompression += std::max(0., compression) / sph.particles.size();
+            statistics.meanDensityError += std::abs(compression) / sph.particles.size();
+        }
+
+        statistics.maxMeanCompression = std::max(statistics.maxMeanCompression, meanCompression);
+    }
+
+    for (const auto& particle : sph.particles)
+    {
+        statistics.maxX = std::max(statistics.maxX, particle.position.x);
+        statistics.maxSpeed = std::max(statistics.maxSpeed, particle.velocity.calcNorm());
+    }
+
+    return statistics;
+}
+
+} // namespace TestScenes
+} // namespace TestEnvironment
+} // namespace SPHSDK
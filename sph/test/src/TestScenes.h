@@ -0,0 +1,77 @@
+/**
+ * @file TestScenes.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef TEST_SCENES_H_8F3A61C2D74E4B0E9C5B27A1E6D03F94
+#define TEST_SCENES_H_8F3A61C2D74E4B0E9C5B27A1E6D03F94
+
+#include "Particle.h"
+#include "Scene.h"
+#include "Solver.h"
+
+#include "algorithms/src/Area.h"
+
+#include <functional>
+#include <memory>
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+/**
+ * @brief TestScenes functions set up the blocks and the runs the suites of the solvers share.
+ */
+namespace TestScenes
+{
+
+/**
+ * @brief Fills the cube of sideNumber^3 lattice points in the middle of the volume with the particles at rest and
+ * finds their neighbours.
+ */
+template <class Scalar = double>
+ParticleVectT<Scalar>
+createCube(const SPHAlgorithms::Volume& volume, size_t sideNumber, double spacing = Scene::calcRestSpacing());
+
+/**
+ * @brief Checks that the corners of the cube created by createCube() move away from its center.
+ */
+void expectCornersMoveApart(const ParticleVect& particles);
+
+/**
+ * @brief The state of the dam break over the steps of runDamBreak().
+ */
+struct DamBreakStatistics
+{
+    size_t stepsNumber = 0u;
+
+    size_t maxIterationsNumber = 0u; // the most iterations of the solver in one step
+
+    double maxCompression = 0.; // the largest rho / rho0 - 1 of a particle
+
+    double maxMeanCompression = 0.; // the largest mean of max(0, rho / rho0 - 1) over the particles
+
+    double meanDensityError = 0.; // the mean of |rho / rho0 - 1| after the last step
+
+    double maxX = 0.; // the front of the column after the last step
+
+    double maxSpeed = 0.; // the fastest particle after the last step
+};
+
+/**
+ * @brief Collapses the water column of 0.25 m in the corner of the tank with the solver until the simulated time.
+ * @param iterationsNumber    Returns the iterations of the last step of the solver, none are counted without it
+ */
+DamBreakStatistics runDamBreak(std::unique_ptr<Solver>                     solver,
+                               double                                      simulatedTime,
+                               const std::function<size_t(const Solver&)>& iterationsNumber = nullptr);
+
+} // namespace TestScenes
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // TEST_SCENES_H_8F3A61C2D74E4B0E9C5B27A1E6D03F94
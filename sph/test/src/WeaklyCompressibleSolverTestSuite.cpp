@@ -0,0 +1,154 @@
+/**
+ * @file WeaklyCompressibleSolverTestSuite.cpp
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#include "WeaklyCompressibleSolverTestSuite.h"
+
+#include "TestScenes.h"
+#include "WeaklyCompressibleSolver.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace SPHSDK
+{
+namespace TestEnvironment
+{
+
+/**
+ * @brief Returns two neighbouring particles at the distance along x with the rest density.
+ */
+static ParticleVect createPair(double distance)
+{
+    ParticleVect particles = {Particle(SPHAlgorithms::Point3D(1., 1., 1.)),
+                              Particle(SPHAlgorithms::Point3D(1. + distance, 1., 1.))};
+
+    particles[0].neighbours = {1};
+    particles[1].neighbours = {0};
+
+    WeaklyCompressibleSolver().initialize(particles);
+
+    return particles;
+}
+
+void WeaklyCompressibleSolverTestSuite::taitPressure()
+{
+    ParticleVect particles(3);
+    particles[0].density = Config::WaterDensity;
+    particles[1].density = 1.01 * Config::WaterDensity;
+    particles[2].density = 0.99 * Config::WaterDensity;
+
+    WeaklyCompressibleSolver solver(true, 10.);
+    solver.computePressure(particles);
+
+    const double stiffness = Config::WaterDensity * 100. / Config::TaitExponent;
+
+    EXPECT_DOUBLE_EQ(0., particles[0].pressure);
+    EXPECT_NEAR(stiffness * (std::pow(1.01, Config::TaitExponent) - 1.), particles[1].pressure, 1e-9 * stiffness);
+    // the tension is cut off
+    EXPECT_DOUBLE_EQ(0., particles[2].pressure);
+}
+
+void WeaklyCompressibleSolverTestSuite::densityRateOfApproachingParticles()
+{
+    ParticleVect particles = createPair(0.05);
+    particles[0].velocity = SPHAlgorithms::Point3D(1., 0., 0.);
+
+    WeaklyCompressibleSolver solver(false);
+    solver.computeDensityRates(particles);
+
+    EXPECT_LT(0., solver.m_densityRates[0]);
+    EXPECT_DOUBLE_EQ(solver.m_densityRates[0], solver.m_densityRates[1]);
+
+    particles[0].velocity = SPHAlgorithms::Point3D(-1., 0., 0.);
+    solver.computeDensityRates(particles);
+
+    EXPECT_GT(0., solver.m_densityRates[0]);
+    EXPECT_DOUBLE_EQ(solver.m_densityRates[0], solver.m_densityRates[1]);
+}
+
+void WeaklyCompressibleSolverTestSuite::densityDiffusion()
+{
+    ParticleVect particles = createPair(0.05);
+    particles[0].density = 1.01 * Config::WaterDensity;
+
+    WeaklyCompressibleSolver solver(false);
+    solver.computeDensityRates(particles);
+
+    // the particles are at rest
+    EXPECT_DOUBLE_EQ(0., solver.m_densityRates[0]);
+    EXPECT_DOUBLE_EQ(0., solver.m_densityRates[1]);
+
+    WeaklyCompressibleSolver diffusiveSolver(true);
+    diffusiveSolver.computeDensityRates(particles);
+
+    EXPECT_GT(0., diffusiveSolver.m_densityRates[0]);
+    EXPECT_LT(0., diffusiveSolver.m_densityRates[1]);
+}
+
+void WeaklyCompressibleSolverTestSuite::timeStepFollowsSoundSpeed()
+{
+    ParticleVect particles = createPair(0.05);
+
+    WeaklyCompressibleSolver solver(true, 20.);
+
+    const double restTimeStep = Config::CourantNumber * Config::WaterSupportRadius / 20.;
+    EXPECT_DOUBLE_EQ(restTimeStep, solver.calcTimeStep(particles));
+
+    particles[1].velocity = SPHAlgorithms::Point3D(0., 0., 5.);
+    EXPECT_DOUBLE_EQ(Config::CourantNumber * Config::WaterSupportRadius / 25., solver.calcTimeStep(particles));
+
+    // the force condition
+    particles[1].fTotal = SPHAlgorithms::Point3D(0., 0., 1e4 * Config::WaterDensity);
+    EXPECT_DOUBLE_EQ(0.25 * std::sqrt(Config::WaterSupportRadius / 1e4), solver.calcTimeStep(particles));
+
+    EXPECT_DOUBLE_EQ(Config::MaxTimeStep, WeaklyCompressibleSolver(true, 1.).calcTimeStep(ParticleVect(1)));
+}
+
+/**
+ * @brief The water column collapses in the corner of the tank, the density of the bulk stays within a few percent.
+ * The spray thins out without the tension, so only the compression is bounded per particle.
+ */
+void WeaklyCompressibleSolverTestSuite::damBreakKeepsDensity()
+{
+    const TestScenes::DamBreakStatistics statistics =
+        TestScenes::runDamBreak(std::unique_ptr<Solver>(new WeaklyCompressibleSolver()), 0.2);
+
+    EXPECT_GT(0.2, statistics.maxCompression);
+    EXPECT_GT(0.03, statistics.meanDensityError);
+    // the column spreads along the floor
+    EXPECT_LT(0.25, statistics.maxX);
+}
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+using namespace SPHSDK::TestEnvironment;
+
+TEST(WeaklyCompressibleSolverTestSuite, taitPressure)
+{
+    WeaklyCompressibleSolverTestSuite::taitPressure();
+}
+
+TEST(WeaklyCompressibleSolverTestSuite, densityRateOfApproachingParticles)
+{
+    WeaklyCompressibleSolverTestSuite::densityRateOfApproachingParticles();
+}
+
+TEST(WeaklyCompressibleSolverTestSuite, densityDiffusion)
+{
+    WeaklyCompressibleSolverTestSuite::densityDiffusion();
+}
+
+TEST(WeaklyCompressibleSolverTestSuite, timeStepFollowsSoundSpeed)
+{
+    WeaklyCompressibleSolverTestSuite::timeStepFollowsSoundSpeed();
+}
+
+TEST(WeaklyCompressibleSolverTestSuite, damBreakKeepsDensity)
+{
+    WeaklyCompressibleSolverTestSuite::damBreakKeepsDensity();
+}
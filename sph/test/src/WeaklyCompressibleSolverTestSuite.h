@@ -0,0 +1,33 @@
+/**
+ * @file WeaklyCompressibleSolverTestSuite.h
+ * @author Anton Artiukh (artyukhanton@gmail.com)
+ * @date Created Oct 19, 2026
+ **/
+
+#ifndef WEAKLY_COMPRESSIBLE_SOLVER_TEST_SUITE_H_4AED3EB6471A42DB84A550143B74366A
+#define WEAKLY_COMPRESSIBLE_SOLVER_TEST_SUITE_H_4AED3EB6471A42DB84A550143B74366A
+
+namespace SPHSDK
+{
+
+namespace TestEnvironment
+{
+
+class WeaklyCompressibleSolverTestSuite
+{
+public:
+    static void taitPressure();
+
+    static void densityRateOfApproachingParticles();
+
+    static void densityDiffusion();
+
+    static void timeStepFollowsSoundSpeed();
+
+    static void damBreakKeepsDensity();
+};
+
+} // namespace TestEnvironment
+} // namespace SPHSDK
+
+#endif // WEAKLY_COMPRESSIBLE_SOLVER_TEST_SUITE_H_4AED3EB6471A42DB84A550143B74366A